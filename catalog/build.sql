@@ -0,0 +1,35 @@
+-- Builds the read-only catalog image bundled with CONFIG+=catalog_image.
+-- Run from this directory:  sqlite3 catalog.db < build.sql
+--
+-- Bump user_version whenever the catalog data changes; installed copies are
+-- replaced when their header no longer matches the bundled image.
+
+.bail on
+PRAGMA foreign_keys = ON;
+PRAGMA page_size = 4096;
+
+BEGIN;
+.read schema.sql
+CREATE TEMP TABLE course_csv AS
+SELECT course_code, course_title, course_description, course_credits,
+       course_classification, dep_code, course_type, course_level
+FROM course WHERE 0;
+
+.mode csv
+.import --skip 1 institution.csv institution
+.import --skip 1 schools.csv school
+.import --skip 1 departments.csv department
+.import --skip 1 --schema temp courses.csv course_csv
+
+-- course_key is stored before VACUUM can renumber rowids; see addCatalogKeys()
+INSERT INTO course
+SELECT course_csv.*, course_csv.rowid FROM temp.course_csv ORDER BY course_csv.rowid;
+DROP TABLE temp.course_csv;
+
+.import --skip 1 majors.csv major
+.import --skip 1 prerequisites.csv course_prereq
+COMMIT;
+
+PRAGMA foreign_key_check;
+PRAGMA user_version = 7;
+VACUUM;
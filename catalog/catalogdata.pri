@@ -0,0 +1,12 @@
+# Compiled-in catalog used to seed Catalog.db when no image is bundled;
+# shared by the application and the tests that build a database.
+# catalogdata.h is generated from catalog/*.csv by catalog/codegen.sql and
+# checked in, so building needs no sqlite3 shell. After editing a CSV, run
+# `make catalogdata` with sqlite3 on PATH and commit the new header.
+CATALOG_DATA = $$clean_path($$PWD/../catalogdata.h)
+HEADERS += $$CATALOG_DATA
+
+catalogdata.commands = \
+    sqlite3 -batch -cmd $$shell_quote(.cd $$shell_path($$PWD)) :memory: \
+    < $$shell_path($$PWD/codegen.sql) > $$shell_path($$CATALOG_DATA)
+QMAKE_EXTRA_TARGETS += catalogdata
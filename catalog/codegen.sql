@@ -0,0 +1,102 @@
+-- Generates catalogdata.h, the compiled-in catalog that seeds Catalog.db when
+-- no catalog image is bundled. The header is checked in; `make catalogdata`
+-- regenerates it after a CSV changes:
+--   sqlite3 -cmd ".cd catalog" :memory: < codegen.sql > catalogdata.h
+--
+-- Strings become C++ literals: backslashes, quotes and line breaks escaped.
+
+.bail on
+.mode csv
+.import schools.csv school
+.import departments.csv department
+.import courses.csv course
+.import majors.csv major
+.import prerequisites.csv course_prereq
+
+CREATE TEMP TABLE literal (raw text primary key, cpp text not null);
+INSERT OR IGNORE INTO literal
+SELECT value, '"' || replace(replace(replace(replace(value,
+           '\', '\\'), '"', '\"'), char(13), ''), char(10), '\n') || '"'
+FROM (SELECT school_code AS value FROM school UNION SELECT school_name FROM school
+      UNION SELECT dep_code FROM department UNION SELECT dep_title FROM department
+      UNION SELECT school_code FROM department
+      UNION SELECT course_code FROM course UNION SELECT course_title FROM course
+      UNION SELECT course_description FROM course UNION SELECT course_classification FROM course
+      UNION SELECT dep_code FROM course UNION SELECT course_type FROM course
+      UNION SELECT course_level FROM course
+      UNION SELECT major_code FROM major UNION SELECT major_name FROM major
+      UNION SELECT department_id FROM major
+      UNION SELECT course_code FROM course_prereq UNION SELECT prereq FROM course_prereq);
+
+.mode list
+.headers off
+
+SELECT '// Generated from catalog/*.csv by catalog/codegen.sql. Do not edit.';
+SELECT '#ifndef CATALOGDATA_H';
+SELECT '#define CATALOGDATA_H';
+SELECT '';
+SELECT '#include "catalogrecords.h"';
+SELECT '';
+SELECT 'namespace CatalogData {';
+
+SELECT '';
+SELECT 'inline constexpr School schools[] = {';
+SELECT '    {' || c.cpp || ', ' || n.cpp || '},'
+FROM school s
+JOIN literal c ON c.raw = s.school_code
+JOIN literal n ON n.raw = s.school_name
+ORDER BY s.rowid;
+SELECT '};';
+
+SELECT '';
+SELECT 'inline constexpr Department departments[] = {';
+SELECT '    {' || c.cpp || ', ' || t.cpp || ', ' || s.cpp || '},'
+FROM department d
+JOIN literal c ON c.raw = d.dep_code
+JOIN literal t ON t.raw = d.dep_title
+JOIN literal s ON s.raw = d.school_code
+ORDER BY d.rowid;
+SELECT '};';
+
+SELECT '';
+SELECT 'inline constexpr Course courses[] = {';
+SELECT '    {' || code.cpp || ', ' || title.cpp || ',' || char(10)
+       || '     ' || description.cpp || ',' || char(10)
+       || '     ' || CAST(c.course_credits AS integer) || ', ' || classification.cpp || ', '
+       || dep.cpp || ', ' || type.cpp || ', ' || level.cpp || '},'
+FROM course c
+JOIN literal code ON code.raw = c.course_code
+JOIN literal title ON title.raw = c.course_title
+JOIN literal description ON description.raw = c.course_description
+JOIN literal classification ON classification.raw = c.course_classification
+JOIN literal dep ON dep.raw = c.dep_code
+JOIN literal type ON type.raw = c.course_type
+JOIN literal level ON level.raw = c.course_level
+ORDER BY c.rowid;
+SELECT '};';
+
+SELECT '';
+SELECT 'inline constexpr Major majors[] = {';
+SELECT '    {' || CAST(m.major_id AS integer) || ', ' || c.cpp || ', ' || n.cpp || ', '
+       || d.cpp || ', ' || CAST(m.credit_requirements AS integer) || '},'
+FROM major m
+JOIN literal c ON c.raw = m.major_code
+JOIN literal n ON n.raw = m.major_name
+JOIN literal d ON d.raw = m.department_id
+ORDER BY m.rowid;
+SELECT '};';
+
+SELECT '';
+SELECT 'inline constexpr Prerequisite prerequisites[] = {';
+SELECT '    {' || c.cpp || ', ' || r.cpp || ', '
+       || CASE WHEN p.prereq_is_corequisite IN ('1', 'true') THEN 'true' ELSE 'false' END || '},'
+FROM course_prereq p
+JOIN literal c ON c.raw = p.course_code
+JOIN literal r ON r.raw = p.prereq
+ORDER BY p.rowid;
+SELECT '};';
+
+SELECT '';
+SELECT '} // namespace CatalogData';
+SELECT '';
+SELECT '#endif // CATALOGDATA_H';
@@ -0,0 +1,44 @@
+-- Catalog tables shipped in the prebuilt catalog image.
+-- Keep in sync with DatabaseInitializer::createCatalogTables().
+
+CREATE TABLE IF NOT EXISTS institution (
+    institution_code text not null primary key,
+    institution_name text not null);
+
+CREATE TABLE IF NOT EXISTS school (
+    school_code text not null primary key,
+    school_name text not null);
+
+CREATE TABLE IF NOT EXISTS department (
+    dep_code text not null primary key,
+    dep_title text not null,
+    school_code text not null references school);
+
+CREATE TABLE IF NOT EXISTS course (
+    course_code varchar not null primary key,
+    course_title text not null,
+    course_description text,
+    course_credits integer not null,
+    course_classification varchar,
+    dep_code varchar not null references department,
+    course_type varchar,
+    course_level text,
+    course_key integer);
+
+CREATE TABLE IF NOT EXISTS course_prereq (
+    course_code text not null references course,
+    prereq text not null references course,
+    prereq_is_corequisite integer default 0 not null,
+    primary key (course_code, prereq));
+
+CREATE TABLE IF NOT EXISTS major (
+    major_id integer primary key autoincrement,
+    major_code text not null,
+    major_name text not null,
+    department_id integer not null references department,
+    credit_requirements integer not null);
+
+-- Keep in sync with the catalog migrations in databaseinitializer.cpp
+CREATE UNIQUE INDEX IF NOT EXISTS course_course_key ON course (course_key);
+CREATE INDEX IF NOT EXISTS course_prereq_prereq ON course_prereq (prereq, course_code);
+CREATE INDEX IF NOT EXISTS major_name ON major (major_name);
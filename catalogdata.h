@@ -0,0 +1,360 @@
+// Generated from catalog/*.csv by catalog/codegen.sql. Do not edit.
+#ifndef CATALOGDATA_H
+#define CATALOGDATA_H
+
+#include "catalogrecords.h"
+
+namespace CatalogData {
+
+inline constexpr School schools[] = {
+    {"SHSS", "School of Humanities and Social Sciences"},
+    {"SBA", "School of Business Administration"},
+    {"SSE", "School of Science and Engineering"},
+};
+
+inline constexpr Department departments[] = {
+    {"CSC", "Computer Science", "SSE"},
+    {"ACC", "Accounting", "SBA"},
+    {"MTH", "Mathematics", "SSE"},
+    {"FYE", "First Year Experience", "SHSS"},
+    {"FAS", "Foundations of Academic Success", "SHSS"},
+    {"ARB", "Arabic", "SHSS"},
+    {"ENG", "English", "SHSS"},
+    {"Basic Sciences", "Basic Sciences", "SSE"},
+    {"EGR", "General Engineering", "SSE"},
+    {"COM", "Communication", "SHSS"},
+    {"HUM", "Humanities", "SHSS"},
+    {"LIT", "Literature", "SHSS"},
+    {"PHI", "Philosophy", "SHSS"},
+    {"ART", "Art", "SHSS"},
+    {"HIS", "History", "SHSS"},
+    {"PSC", "Political Science", "SHSS"},
+    {"ECO", "Economics", "SBA"},
+    {"GEO", "Geography", "SHSS"},
+    {"PSY", "Psychology", "SHSS"},
+    {"SOC", "Sociology", "SHSS"},
+    {"SSC", "Social Sciences", "SHSS"},
+    {"FIN", "Finance", "SBA"},
+    {"MGT", "Management", "SBA"},
+    {"GBU", "General Business", "SBA"},
+    {"MIS", "Management Information Systems", "SBA"},
+    {"MKT", "Marketing", "SBA"},
+    {"SCM", "Supply Chain Management", "SBA"},
+    {"SPN", "Spanish", "SHSS"},
+    {"FRN", "French", "SHSS"},
+    {"GER", "German", "SHSS"},
+};
+
+inline constexpr Course courses[] = {
+    {"MTH1303", "Calculus I: Differential and Integral Calculus",
+     "The emphasis of this course is on problem solving, not on the presentation of theoretical considerations. While the course necessarily includes some discussion of theoretical notions, its primary objective is not the production of theorem-provers. The syllabus for MTH 1303 includes most of the elementary topics in the theory of real-valued functions of a real variable: limits, continuity, derivatives, maxima and minima, integration, trigonometric, logarithmic, and exponential functions and techniques of integration.",
+     3, "Freshman", "MTH", "Mathematics", ""},
+    {"CSC1401", "Computer Programming",
+     "This course covers algorithms and problem solving, basic algorithmic analysis, fundamental programming constructs and data structures, and basic algorithmic strategies. Students will learn the basic skills of constructing a problem solution and will illustrate this in labs with a high-level language (currently C). Students will also be introduced to different aspects of ethics in Computer Science.",
+     4, "Freshman", "CSC", "Core", "Beginner"},
+    {"FYE1101", "First Year Experience",
+     "Throughout their first year, all incoming students will enroll in a Pass/Fail, one-credit Seminar (FYE 1101 during the first semester and FYE 1102 during the second one) and will also be paired with a peer mentor for their first semester to provide them with guidance, advice, feedback and support during this new journey. The FYE Seminars consist of a series of informative forums developed through collaboration between the Division of Student Affairs and Academic Affairs. Incoming students will be charged 2500 MAD to cover orientation and program fees. Additionally, they will pay 2100 MAD for each of the one-credit Seminars.",
+     1, "Freshman", "FYE", "General Education", ""},
+    {"FAS0210", "Foundations for Academic Success: Strategic Academic Skills",
+     "This course offers basic study skills and information literacy skills preparing students for academic success at AUI. Students are trained to take responsibility for their own learning through tasks that require them to reflect on, as well as evaluate, their current study habits, and to implement new strategies that improve their learning. Students are also introduced to the Information Literacy Skills necessary to communicate effectively in online, classroom, academic, and group contexts. These skills include being able to locate, evaluate, synthesize, and present information efficiently and effectively. They learn and practice the principles of effective academic research and demonstrate their mastery in a final project. This course can be waived upon successful completion of a placement test or upon meeting portfolio requirements.",
+     2, "Freshman", "FAS", "General Education", ""},
+    {"ARB1241", "Arabic Literature",
+     "The aim of this course, taught in Arabic, is to promote the knowledge of different literary genres and to enable students to differentiate between them and to appreciate beauty in a literary work of art. Literary concepts are introduced to students and followed by reading, analysis, and discussion of works drawn from various genres. The texts are either originally written in Arabic or translated into Arabic from other languages. In addition to its literary and aesthetic value, the collection of texts used belongs to a variety of literary genres and is written by authors of diverse nationalities. This course is designed exclusively for students with a Moroccan baccalaureate or an Arabic-based high school degree from any country. However, other students whose placement test scores indicate that they have the capability to attend this course may enroll in it.",
+     2, "Freshman", "ARB", "General Education", ""},
+    {"ENG1301", "English Composition I",
+     "This course introduces students to the essay genres of reflecting, reporting, explaining, and arguing. This involves writing several genres of academic essay following the process approach to construction, including four out-of-class essays. The expository and argumentative essays are sourced from a course reader. At least two additional essays are written in class on topics not announced in advance. Additional exercises deemed important for learning fluent and accurate writing are assigned from a course rhetoric/grammar text and other supplementary material. A semester-long project of keeping a writer's journal may be part of the instruction.",
+     3, "Freshman", "ENG", "General Education", ""},
+    {"CSC2302", "Data Structures",
+     "This course will build on the knowledge and skills acquired in the introductory programming course. It covers different types of data structures (lists, queues, graphs, etc.) and the associated algorithms, emphasizing memory vs. CPU tradeoffs.",
+     3, "Freshman", "CSC", "Core", ""},
+    {"MTH2301", "Calculus II: Multivariable Calculus",
+     "Multivariable calculus covers vectors and surfaces, partial differentiation, multiple integration, and vector calculus, including Green's Theorem and Stokes' Theorem.",
+     3, "Freshman", "MTH", "Mathematics", ""},
+    {"MTH2320", "Linear and Matrix Algebra",
+     "The course covers differential equations, including basic concepts, first-order differential equations and applications, linear differential equations of higher order, series solutions, solutions using Laplace transforms, and solutions using numerical methods and applications.",
+     3, "Freshman", "MTH", "Mathematics", ""},
+    {"MTH3301", "Probability and Statistics for Engineers",
+     "This course is a calculus-based introduction to probability and statistics with a focus on techniques and applications most relevant to engineering. Topics include basic probability, conditional probability, independence of events, random variables, cumulative distribution functions, density functions, expectation, variance and covariance, independence of events and random variables, common discrete and continuous distributions, Law of Large Numbers, the Central Limit Theorem, and an introduction to descriptive statistics and sampling distributions",
+     3, "", "MTH", "Mathematics", ""},
+    {"MTH1304", "Discrete Mathematics for Engineers",
+     "This course is an introduction to the fundamental ideas of discrete mathematics. Topics covered in this course include logic, sets, relations, function, number representation, graphs, and counting techniques and their applications to probabilistic reasoning. The aim of the course is to give the students a foundation for the development of more advanced mathematical concepts that are used in computer science and engineering.",
+     3, "", "MTH", "", ""},
+    {"CHE1401", "General Chemistry I",
+     "This course starts with the basics of chemistry and chemical reactions. It then gives an insight into the structure of matter and the origin of chemical periodicity. The course provides an introduction to the fundamentals of atomic structure, the periodic table, nomenclature, chemical equations and solutions. The concepts of chemical bonding and molecular structure are also developed. The laboratory sessions are designed to reinforce the lecture material and to allow students to become familiar with the experimental procedures used in chemistry.",
+     4, "", "Basic Sciences", "", ""},
+    {"PHY1401", "Physics I",
+     "This course provides engineering students with the basic knowledge of mechanics and vibration required for the advanced engineering course. Theoretical and experimental concepts covered include physical quantities, linear motion, Newton's law of motion, work, energy, momentum, systems in equilibrium, periodic motion, elasticity, fluid mechanics, the universal law of gravitation, the general form of gravitational potential energy, temperature and thermal expansion.",
+     4, "", "Basic Sciences", "", ""},
+    {"PHY1402", "Physics II",
+     "This course is a continuation of General Physics I (Phy1401), it provides you with fundamental knowledge of: Electricity, and magnetism required in follow up-courses in electric circuits, electromagnetism, communications, and sensor systems. Sound waves required in conversion to electrical signals. Optics required in follow-up courses in electromagnetism, communications, and sensor systems. Theoretical and experimental topics include wave productions and propagation, standing waves, wave effects, sound, electric fields and forces, electromagnetic induction, AC circuits, light, optical systems, interference, and diffraction",
+     4, "", "Basic Sciences", "", ""},
+    {"CSC2306", "Object Oriented Programming",
+     "This course will build on the broad understanding acquired in the previous programming courses to allow students to scale-up and be able to solve more complex problems through object-oriented methodology. The object-oriented paradigm encapsulates code complexity within objects and integrates features such as abstraction, cohesion, encapsulation, information hiding, inheritance, and polymorphism. The object-oriented approach emphasizes software qualities such as robustness, maintainability, extensibility, and reusability principles into software development. Students will gain experience building object-oriented software solutions using the Unified Modeling Language (UML) and the Java programming language.",
+     3, "", "CSC", "Required", "Undergraduate"},
+    {"CSC2305", "Computer Organization and Architecture",
+     "This course provides a discussion of the fundamentals of computer organization and architecture and relates it to contemporary design issues. Students will gain an understanding of the basic structure and operation of a digital computer. Topics include digital logic, instruction set architecture, computer arithmetic, architectural CPU design, and functional computer organization. Besides emphasizing the fundamental concepts, the course will discuss the critical role of performance in driving computer design.",
+     3, "", "CSC", "Required", "Undergraduate"},
+    {"CSC3315", "Languages and Compilers",
+     "This course examines computer languages from the perspective of translation and the computational models they implement. The first half of the course reviews the evolution of languages, language design principles, and evaluation criteria, then presents the processing stages, theoretical concepts, and tools associated with language translation. The second half of the course introduces languages representing different programming paradigms and examines runtime handling of selected language features.",
+     3, "Junior", "CSC", "Required", "Undergraduate"},
+    {"CSC3351", "Operating Systems",
+     "This course introduces students to fundamental concepts of operating systems. It emphasizes structures, key design issues, as well as the fundamental principles behind modern operating systems. It covers concurrency, scheduling, memory and device management, file systems, and scripting. The course uses implementations of Unix-like and Windows systems to illustrate some concepts.",
+     3, "", "CSC", "Required", "Undergraduate"},
+    {"CSC3374", "Advanced and Distributed Programming Paradigms",
+     "This course provides theoretical knowledge about, and practical skills in advanced programming paradigms. It builds on the background acquired in introductory programming courses and other prerequisite courses to tackle programming models used in professional, enterprise-grade software development. Covered topics are organized into five parts, where each build on previous ones: Programming for communication, integration, performance, extensibility, and scalability.",
+     3, "", "CSC", "Required", "Undergraduate"},
+    {"CSC3323", "Analysis of Algorithms",
+     "This course covers the study of algorithm design, including introductory concepts: sorting and searching algorithms; string, graph, and set algorithms; complexity classes; branch and bound algorithms; dynamic programming, and advanced topics.",
+     3, "Junior", "CSC", "Required", "Undergraduate"},
+    {"CSC3324", "Software Engineering",
+     "Software Engineering is the application of engineering principles and techniques to the process of software development, delivery, maintenance, and decommission. Its purpose is to make the building of software systems formal and predictable, while delivering high quality software products that comply with client requirements and expectations. The main goal of this course is to learn how to build Professional Software, in a Business Environment, using a formal development framework/methodology, and to develop the necessary skills of Modeling, Analysis and Design, including System Architecture and Technology Stack issues, necessary to this end.",
+     3, "", "CSC", "Required", "Undergraduate"},
+    {"CSC3371", "Computer Communications and Networks",
+     "This course covers topics in data communications of interest to computing majors, such as types of LAN, VLAN, MAN, and WAN networks, with their corresponding access methods and link layer protocols. The course then moves on to cover the TCP/IP protocol stack, including IP functions such as addressing, routing, congestion control, and Transport layer function, such as reliable transmission and flow control. The course culminates into the coverage of major Internet enabling services and application layer protocols, namely DNS, SMTP, and HTTP.",
+     3, "", "CSC", "Required", "Undergraduate"},
+    {"CSC3326", "Database Systems",
+     "The course covers the design and implementation of Relational databases. While significant focus is placed on Entity-Relationship and Relational modeling, other models and current trends in database are introduced. Relational Algebra and SQL are covered, including procedural SQL. A Relational DBMS is used along with database application development as lab work and class projects. Transactions and concurrency issues are also addressed.",
+     3, "Junior", "CSC", "Required", "Undergraduate"},
+    {"EGR2302", "Engineering Economics",
+     "This course covers the time value of economic resources, engineering project investments analysis, and the effect of taxes on engineering project decisions. Students learn about societal, technical, economic, environmental, political, legal, and ethical analyses of project alternatives",
+     3, "", "EGR", "", ""},
+    {"FYE1102", "First Year Experience II",
+     "Continuation of the first-year experience program focusing on academic success and campus integration.",
+     1, "freshman", "FYE", "", ""},
+    {"FAS1220", "Introduction to Critical Thinking",
+     "Designed to develop students understanding of the critical thinking process, with a view to improving their own reasoning and analysis skills.",
+     2, "freshman", "FAS", "", ""},
+    {"COM1301", "Public Speaking",
+     "Develops public speaking and group discussion skills. Students engage in public speaking activities designed to promote competency in delivery of speeches, organization of ideas, methods of argumentation, and utilization of supporting materials.",
+     3, "freshman", "COM", "", ""},
+    {"ENG2303", "Technical Writing",
+     "Develops writing skills necessary for advanced undergraduate writing in SSE courses and for future writing tasks in professional contexts. Students write resumes, cover letters, memorandums, reports, professional emails, and a final research paper.",
+     3, "sophomore", "ENG", "", ""},
+    {"HUM2305", "Science and Society",
+     "Provides understanding of science as an intellectual endeavor and the contemporary world shaped by science. Examines the nature of scientific knowledge and its relationship to other kinds of knowledge, technology, and power.",
+     3, "sophomore", "HUM", "", ""},
+    {"HUM2306", "Comparative Religion",
+     "Introduction to the world major religions: Islam, Christianity, Judaism, Buddhism, and Hinduism. Covers ideas and concepts that have shaped religions and themes shared by all of them.",
+     3, "sophomore", "HUM", "", ""},
+    {"HUM2307", "History of Islamic Technology",
+     "Survey of technological advances in the Middle East and North Africa in the pre-modern era, showing intellectual and technological exchanges between Muslims and their neighbors.",
+     3, "sophomore", "HUM", "", ""},
+    {"LIT2301", "Major Works of World Literature",
+     "Gives students a generous sampling of major works of World Literature using a multi-disciplinary approach, focusing on reading, analyzing, and discussing works from various historical periods and genres.",
+     3, "sophomore", "LIT", "", ""},
+    {"PHI2301", "Philosophical Thought",
+     "Introduction to Philosophy examining principal themes of philosophical inquiry from both historical and multicultural perspective. Contributes to understanding ideas that shape human life.",
+     3, "sophomore", "PHI", "", ""},
+    {"PHI2302", "History of Ideas",
+     "Examines influential ideas in distinct areas of thought and from diverse intellectual traditions, analyzing them within historical context and tracing their origin and development.",
+     3, "sophomore", "PHI", "", ""},
+    {"ART1301", "Introduction to Drawing",
+     "Fundamental course in drawing techniques and principles for beginners.",
+     3, "freshman", "ART", "", ""},
+    {"ART1302", "Introduction to Painting",
+     "Basic painting techniques and color theory for beginning artists.",
+     3, "freshman", "ART", "", ""},
+    {"ART1303", "Introduction to Sculpture",
+     "Fundamental principles and techniques of three-dimensional art forms.",
+     3, "freshman", "ART", "", ""},
+    {"ART1304", "Introduction to Digital Art",
+     "Basic digital art creation using contemporary software and tools.",
+     3, "freshman", "ART", "", ""},
+    {"ART1305", "Art History Survey",
+     "Comprehensive overview of major movements and periods in art history.",
+     3, "freshman", "ART", "", ""},
+    {"ART3399", "Special Topics in Art",
+     "Specially scheduled courses on significant issues or topics relevant to the study of art. Content varies according to faculty expertise.",
+     3, "junior", "ART", "", ""},
+    {"ENG2320", "Creative Writing",
+     "Students immerse themselves in reading and writing, creating their own community of writers. Examines how craft transforms source material and brings instinct and critical understanding into equilibrium.",
+     3, "sophomore", "ENG", "", ""},
+    {"HUM2301", "Islamic Art and Architecture",
+     "Introduction to Islamic art and architecture with emphasis on the Maghreb and Al-Andalus. Covers the period of formation of Islamic art and surveys art and architecture of major dynasties.",
+     3, "sophomore", "HUM", "", ""},
+    {"COM2327", "Art and Design Production",
+     "Introduces fundamental art concepts and histories important in all aspects of contemporary design from print and photography to website interface. Covers vocabulary and working terms of artists and designers.",
+     3, "sophomore", "COM", "", ""},
+    {"LIT3370", "Aesthetics",
+     "Examines aesthetic theory, basic themes such as notion of aesthetic, definition of art, taste, value of art, beauty, interpretation, and artistic imagination. Focuses on four categories of art forms: literature, dramatic arts, music, and visual arts.",
+     3, "junior", "LIT", "", ""},
+    {"HIS1301", "History of the Arab World",
+     "Covers history of the Arab world from the rise of Islam to the present, taking social and cultural approach to understanding different histories of Arab society. Balances political history with long-term social transformations.",
+     3, "freshman", "HIS", "", ""},
+    {"HIS2301", "Contemporary World History",
+     "Provides broad overview of major developments affecting different parts of the world in the modern era. Focuses on political, social, and cultural history of Europe and interactions with Africa, Asia, and Latin America.",
+     3, "sophomore", "HIS", "", ""},
+    {"HUM1310", "History and Culture of the Amazigh",
+     "Provides insight into specifics of Amazigh culture and institutions, covering origins, distribution, and common history of Amazigh peoples of North Africa from ancient history to medieval times.",
+     3, "freshman", "HUM", "", ""},
+    {"HUM2302", "Islamic Societies",
+     "Introduction to historical and contemporary study of Islamic societies using interdisciplinary approach. Explores topics including history, theology, mysticism, architecture, political theory, literature, and fine arts.",
+     3, "sophomore", "HUM", "", ""},
+    {"PSC2301", "Comparative Political Systems",
+     "Provides solid introduction to major concepts, theories, and debates relevant to contemporary politics. Includes analysis of origins and development of the state, with particular emphasis on the democratic state.",
+     3, "sophomore", "PSC", "", ""},
+    {"ECO1300", "Introduction to Economics",
+     "Introduces essentials of both microeconomics and macroeconomics. Topics include supply and demand, price elasticity, producer and consumer choices, market structures, GDP, inflation, labor market, and international trade.",
+     3, "freshman", "ECO", "", ""},
+    {"GEO1301", "Introduction to Geography",
+     "Introductory social science course providing survey of principles of human geography. Initiates students in basic concepts required for spatial analysis of social phenomena, including notions of scale and cartographic representation.",
+     3, "freshman", "GEO", "", ""},
+    {"PSY1301", "Introduction to Psychology",
+     "Introductory survey of major content areas and theoretical models of psychology emphasizing scientific approach to critically understand human behavior. Examines behavior as product of interaction between biology, culture, and individual abilities.",
+     3, "freshman", "PSY", "", ""},
+    {"SOC1301", "Principles of Sociology",
+     "Introduction to sociology covering range of objects of sociological investigation, including socialization, deviance, social stratification, family, gender, race, and ethnicity. Introduces scope, approach, research methods, and ethical concerns.",
+     3, "freshman", "SOC", "", ""},
+    {"SSC1310", "Introduction to Anthropology",
+     "Introduction to principles and processes of Cultural Anthropology with emphasis on Applied Anthropology. Has strong theoretical base linking social, economic, and political organizations to wider considerations of environment and culture.",
+     3, "freshman", "SSC", "", ""},
+    {"EGR4300", "Internship",
+     "On-the-job education and training in a public or private sector agency or business related to the student's major. Requires consultation with internship director and three-party contract.",
+     3, "senior", "EGR", "", ""},
+    {"EGR4402", "Capstone Design",
+     "Project-design course to consolidate information from all previous courses, identifying appropriate standards and incorporating realistic constraints. Taken during last regular semester of enrollment.",
+     4, "senior", "EGR", "", ""},
+    {"ACC2301", "Accounting Principles I",
+     "Introduction to fundamental concepts of financial accounting, double entry accounting theory, recording procedures, and financial statements preparation and analysis.",
+     3, "sophomore", "ACC", "", ""},
+    {"FIN3301", "Principles of Finance",
+     "Financial management for business and the corporation emphasizes the conceptual framework and principles of financial management for business organizations. Integrates knowledge from introductory courses in accounting and economics.",
+     3, "junior", "FIN", "", ""},
+    {"MGT3301", "Principles of Management",
+     "Overview of the art and science of Management. Broad categories covered are evolution of management theory, decision-making procedures, foundations of leading and managing, and strategic management.",
+     3, "junior", "MGT", "", ""},
+    {"ACC2302", "Accounting Principles II",
+     "Covers basic cost relationships, cost behavior, cash flow statements, financial statement analysis including ratio analysis, cost of products for managerial decision-making, forecasting, budgeting, and profitability analysis.",
+     3, "sophomore", "ACC", "", ""},
+    {"GBU3311", "Quantitative Methods in Business",
+     "Provides foundations of statistical methods for managerial decision-making. Offers extensive coverage of inferential statistics: hypothesis testing, ANOVA, chi-square tests, regression analysis, and time series forecasting.",
+     3, "junior", "GBU", "", ""},
+    {"GBU4308", "Foundations of E-Commerce",
+     "Introduces concepts and methods surrounding electronic commerce practices. Student gains command of current e-commerce business models, opportunities, and related barriers. Focus on innovative thinking for turning e-commerce technologies into value.",
+     3, "senior", "GBU", "", ""},
+    {"MGT3302", "Entrepreneurship",
+     "Introduces role of entrepreneur in economic system and covers how to start, finance, and operate successful business. Focuses on developing business plan, sources of capital, recruiting, forecasting, and financial planning.",
+     3, "junior", "MGT", "", ""},
+    {"MGT4303", "Operations Management",
+     "Introduces field of operations management and state-of-the-art view of primary activities of operations function in manufacturing and service organizations. Provides basic principles of designing, analyzing, and controlling production systems.",
+     3, "senior", "MGT", "", ""},
+    {"MIS3302", "Managing Information Systems and Technology in the Global Marketplace",
+     "Covers managerial and organizational issues involved in operating a firm. Reviews role of automated information processing, automated support processes, and information systems. Examines planning development, direction, and control of computer information systems.",
+     3, "junior", "MIS", "", ""},
+    {"MKT3301", "Principles of Marketing",
+     "Gives outline of common marketing concepts and models with purpose of developing responsive marketing strategies that meet customers' needs. Focuses on use of marketing in organizations and society.",
+     3, "junior", "MKT", "", ""},
+    {"MKT4304", "Marketing Research",
+     "Focuses on use of marketing research as aid to making marketing decisions. Addresses how information used to make marketing decisions is gathered and analyzed. Topics include marketing research process, research design, methodologies, data collection, analysis, and interpretation.",
+     3, "senior", "MKT", "", ""},
+    {"MKT4305", "Marketing Management",
+     "Concerned with development, evaluation, and implementation of marketing management in complex environments. Focuses on formulating and implementing marketing management strategies and policies at strategic business unit level.",
+     3, "senior", "MKT", "", ""},
+    {"SCM4301", "Introduction to Supply Chain Management",
+     "Supply chain management is integration of all activities associated with flow and transformation of goods. Provides introduction to logistics and supply chain concepts, structures, design, and control.",
+     3, "senior", "SCM", "", ""},
+    {"CSC4307", "Agile Software Engineering and DevOps",
+     "Focuses on agility in software engineering: its values, principles, roles, practices, frameworks, and tools. Compares agile software development against traditional phase-based methodologies. Emphasizes Continuous Integration and Continuous Delivery.",
+     3, "senior", "CSC", "", ""},
+    {"CSC4309", "Enterprise Cloud and Mobile Application Architecture, Design and Development",
+     "Provides solid background on architecture, design and full stack development of enterprise-class, cloud-based, mobile-first progressive applications, based on well-defined security, performance, scalability, extensibility and integration requirements.",
+     3, "senior", "CSC", "", ""},
+    {"CSC3359", "Software Testing and Analysis",
+     "Presents overview of principles and practices of software testing. Covers different concepts and techniques on how to test software. Topics include various testing methods such as structural and functional testing.",
+     3, "junior", "CSC", "", ""},
+    {"CSC3309", "Introduction to Artificial Intelligence",
+     "Provides students with concepts and knowledge to design intelligent agents by leveraging main skills of AI programming, namely searching for goals and planning, knowledge representation, logical and probabilistic inferencing, and learning from experience.",
+     3, "junior", "CSC", "", ""},
+    {"SPN1301", "Beginning Spanish I",
+     "Intended for students with no basic knowledge in Spanish. Students apply, develop, and integrate different language skills: listening, speaking, reading comprehension, and writing. Upon completion, students can express themselves in spoken and written Spanish.",
+     3, "freshman", "SPN", "", ""},
+    {"FRN2210", "Intermediate French",
+     "Consolidates and extends vocabulary, speaking and comprehension abilities. Uses variety of reading materials including complex narratives and short poetry. Offers insight into culture and history of Francophone world.",
+     2, "sophomore", "FRN", "", ""},
+    {"FRN3210", "Advanced French Communication",
+     "Develops advanced French communication skills for academic and professional contexts. Focuses on complex grammatical structures, advanced vocabulary, and nuanced expression in both written and spoken French.",
+     2, "junior", "FRN", "", ""},
+    {"GER1301", "Beginning German I",
+     "Introductory course in German language for beginners. Focuses on basic communication skills, grammar, vocabulary, and cultural understanding.",
+     3, "freshman", "GER", "", ""},
+};
+
+inline constexpr Major majors[] = {
+    {1, "CS", "Computer Science", "CSC", 134},
+};
+
+inline constexpr Prerequisite prerequisites[] = {
+    {"CSC2302", "CSC1401", false},
+    {"MTH2301", "MTH1303", false},
+    {"MTH2320", "MTH2301", false},
+    {"MTH3301", "MTH2301", false},
+    {"PHY1401", "MTH1303", false},
+    {"PHY1402", "PHY1401", false},
+    {"CSC2306", "CSC2302", false},
+    {"CSC2306", "MTH1304", false},
+    {"CSC2305", "CSC2302", false},
+    {"CSC2305", "PHY1402", false},
+    {"CSC3315", "CSC2306", false},
+    {"CSC3351", "CSC2305", false},
+    {"CSC3374", "CSC3326", false},
+    {"CSC3374", "CSC3351", false},
+    {"CSC3323", "CSC2302", false},
+    {"CSC3324", "CSC2306", false},
+    {"CSC3371", "CSC2305", false},
+    {"CSC3326", "CSC2306", false},
+    {"EGR2302", "MTH1303", false},
+    {"FAS1220", "FAS0210", false},
+    {"ENG2303", "ENG1301", false},
+    {"ENG2303", "COM1301", false},
+    {"HUM2305", "FAS1220", false},
+    {"HUM2306", "FAS1220", false},
+    {"HUM2307", "FAS1220", false},
+    {"LIT2301", "FAS1220", false},
+    {"LIT2301", "ENG1301", false},
+    {"PHI2301", "FAS1220", false},
+    {"PHI2301", "ENG1301", false},
+    {"PHI2302", "FAS1220", false},
+    {"PHI2302", "ENG1301", false},
+    {"ENG2320", "ENG1301", false},
+    {"HUM2301", "FAS1220", false},
+    {"HIS2301", "FAS1220", false},
+    {"HIS2301", "ENG1301", false},
+    {"HUM1310", "FAS1220", false},
+    {"HUM2302", "FAS1220", false},
+    {"PSC2301", "FAS1220", false},
+    {"PSC2301", "ENG1301", false},
+    {"HIS1301", "FAS1220", true},
+    {"GEO1301", "FAS1220", true},
+    {"SOC1301", "FAS1220", true},
+    {"SSC1310", "FAS1220", true},
+    {"FIN3301", "ACC2301", false},
+    {"FIN3301", "EGR2302", false},
+    {"MGT3301", "ACC2301", false},
+    {"MGT3301", "EGR2302", false},
+    {"GBU3311", "MTH3301", false},
+    {"MKT3301", "ACC2301", false},
+    {"MKT3301", "EGR2302", false},
+    {"CSC4307", "CSC3326", false},
+    {"CSC4307", "CSC3351", false},
+    {"CSC3309", "CSC3323", false},
+    {"CSC3309", "CSC2306", false},
+    {"CSC3309", "MTH3301", false},
+    {"EGR4300", "ENG2303", false},
+    {"EGR4402", "ENG2303", false},
+    {"ACC2302", "ACC2301", false},
+    {"GBU4308", "MGT3301", false},
+    {"MGT3302", "MGT3301", false},
+    {"MGT3302", "MKT3301", false},
+    {"MGT3302", "FIN3301", false},
+    {"MGT4303", "MGT3301", false},
+    {"MGT4303", "GBU3311", false},
+    {"MKT4304", "MKT3301", false},
+    {"MKT4304", "GBU3311", false},
+    {"MKT4305", "MGT3301", false},
+    {"CSC4309", "CSC3374", false},
+    {"CSC3359", "CSC2306", false},
+};
+
+} // namespace CatalogData
+
+#endif // CATALOGDATA_H
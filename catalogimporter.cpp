@@ -0,0 +1,375 @@
+#include "catalogimporter.h"
+#include "prerequisitegraph.h"
+#include <QSqlQuery>
+#include <QSqlError>
+#include <QDebug>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QFileInfo>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QJsonParseError>
+#include <QTextStream>
+
+namespace {
+
+// Reads one record at a time from a CSV or JSON Lines file and hands back
+// the requested columns in order, so memory use doesn't depend on file size.
+class RecordReader
+{
+public:
+    RecordReader(const QString& path, const QStringList& columns)
+        : file(path), columns(columns) {
+        json = QFileInfo(path).suffix().compare("csv", Qt::CaseInsensitive) != 0;
+    }
+
+    bool open() {
+        if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+            error = file.errorString();
+            return false;
+        }
+        in.setDevice(&file);
+        return json || readHeader();
+    }
+
+    bool next(QStringList& values) {
+        while (!in.atEnd()) {
+            ++line;
+            if (json ? readJsonRecord(values) : readCsvRecord(values)) {
+                return true;
+            }
+            if (!error.isEmpty()) {
+                return false;
+            }
+        }
+        return false;
+    }
+
+    QString errorString() const {
+        return error.isEmpty() ? error : file.fileName() + ":" + QString::number(line) + ": " + error;
+    }
+
+private:
+    QFile file;
+    QTextStream in;
+    QStringList columns;
+    QList<int> csvIndexes;
+    bool json;
+    qint64 line = 0;
+    QString error;
+
+    bool readHeader() {
+        QStringList header;
+        ++line;
+        if (in.atEnd() || !readCsvRecord(header)) {
+            error = "missing header row";
+            return false;
+        }
+        for (const QString& column : columns) {
+            int index = header.indexOf(column);
+            if (index == -1) {
+                error = "missing column " + column;
+                return false;
+            }
+            csvIndexes << index;
+        }
+        return true;
+    }
+
+    // Parses one record, following quoted fields across line breaks.
+    // Returns false for blank lines.
+    bool readCsvRecord(QStringList& fields) {
+        fields.clear();
+        QString text = in.readLine();
+        if (text.trimmed().isEmpty()) {
+            return false;
+        }
+
+        QString field;
+        bool quoted = false;
+        for (;;) {
+            for (int i = 0; i < text.size(); ++i) {
+                QChar c = text.at(i);
+                if (quoted) {
+                    if (c != '"') {
+                        field += c;
+                    } else if (i + 1 < text.size() && text.at(i + 1) == '"') {
+                        field += c;
+                        ++i;
+                    } else {
+                        quoted = false;
+                    }
+                } else if (c == '"') {
+                    quoted = true;
+                } else if (c == ',') {
+                    fields << field;
+                    field.clear();
+                } else {
+                    field += c;
+                }
+            }
+            if (!quoted || in.atEnd()) {
+                break;
+            }
+            field += '\n';
+            text = in.readLine();
+            ++line;
+        }
+        fields << field;
+
+        if (csvIndexes.isEmpty()) {
+            return true; // header row
+        }
+
+        QStringList values;
+        for (int index : csvIndexes) {
+            if (index >= fields.size()) {
+                error = "expected at least " + QString::number(index + 1) + " fields";
+                return false;
+            }
+            values << fields.at(index);
+        }
+        fields = values;
+        return true;
+    }
+
+    bool readJsonRecord(QStringList& values) {
+        values.clear();
+        QByteArray text = in.readLine().toUtf8().trimmed();
+        if (text.isEmpty()) {
+            return false;
+        }
+
+        QJsonParseError parseError;
+        QJsonDocument document = QJsonDocument::fromJson(text, &parseError);
+        if (!document.isObject()) {
+            error = parseError.error != QJsonParseError::NoError ? parseError.errorString()
+                                                                 : "expected one object per line";
+            return false;
+        }
+
+        QJsonObject object = document.object();
+        for (const QString& column : columns) {
+            values << object.value(column).toVariant().toString();
+        }
+        return true;
+    }
+};
+
+void reportThroughput(const char* what, ImportStats& stats, const QElapsedTimer& timer) {
+    stats.elapsedMs = timer.elapsed();
+    qDebug() << "Imported" << stats.rows << what << "in" << stats.elapsedMs << "ms"
+             << "(" << qRound(stats.rowsPerSecond()) << "rows/s)";
+}
+
+} // namespace
+
+bool CatalogImporter::importCourses(QSqlDatabase& db, const QString& path,
+                                    ImportStats* stats, int chunkSize) {
+    RecordReader reader(path, QStringList() << "course_code" << "course_title"
+                                            << "course_description" << "course_credits"
+                                            << "course_classification" << "dep_code"
+                                            << "course_type" << "course_level");
+    if (!reader.open()) {
+        qDebug() << "Cannot read courses:" << reader.errorString();
+        return false;
+    }
+
+    ImportStats local;
+    ImportStats& result = stats ? *stats : local;
+    result = ImportStats();
+
+    QElapsedTimer timer;
+    timer.start();
+
+    if (!db.transaction()) {
+        qDebug() << "Failed to begin transaction:" << db.lastError().text();
+        return false;
+    }
+
+    QSqlQuery query(db);
+    // An upsert rather than INSERT OR REPLACE, which would delete the row and
+    // lose the course_key that planned courses refer to
+    query.prepare("INSERT INTO course (course_code, course_title, course_description, course_credits, course_classification, dep_code, course_type, course_level) VALUES (?, ?, ?, ?, ?, ?, ?, ?) "
+                  "ON CONFLICT (course_code) DO UPDATE SET course_title = excluded.course_title, "
+                  "course_description = excluded.course_description, course_credits = excluded.course_credits, "
+                  "course_classification = excluded.course_classification, dep_code = excluded.dep_code, "
+                  "course_type = excluded.course_type, course_level = excluded.course_level");
+
+    QList<Course> chunk;
+    chunk.reserve(chunkSize);
+
+    QStringList values;
+    Course course;
+    while (reader.next(values)) {
+        bool ok = false;
+        course.code = values.at(0);
+        course.title = values.at(1);
+        course.description = values.at(2);
+        course.credits = values.at(3).toInt(&ok);
+        course.classification = values.at(4);
+        course.depCode = values.at(5);
+        course.type = values.at(6);
+        course.level = values.at(7);
+
+        if (course.code.isEmpty() || !ok) {
+            qDebug() << "Invalid course record" << course.code << "after" << result.rows << "rows";
+            db.rollback();
+            return false;
+        }
+
+        chunk.append(course);
+        if (chunk.size() == chunkSize) {
+            if (!insertCourses(query, chunk)) {
+                db.rollback();
+                return false;
+            }
+            result.rows += chunk.size();
+            chunk.clear();
+        }
+    }
+
+    if (!reader.errorString().isEmpty() || !insertCourses(query, chunk)) {
+        qDebug() << "Course import failed:" << reader.errorString();
+        db.rollback();
+        return false;
+    }
+    result.rows += chunk.size();
+
+    // New courses get keys above every existing one; the subquery is
+    // evaluated once, and rowids are distinct, so keys stay unique
+    if (!query.exec("UPDATE course SET course_key = "
+                    "(SELECT coalesce(max(course_key), 0) FROM course) + rowid "
+                    "WHERE course_key IS NULL")) {
+        qDebug() << "Failed to assign course keys:" << query.lastError().text();
+        db.rollback();
+        return false;
+    }
+
+    if (!db.commit()) {
+        qDebug() << "Failed to commit course import:" << db.lastError().text();
+        db.rollback();
+        return false;
+    }
+
+    reportThroughput("courses", result, timer);
+    PrerequisiteGraph::refresh();
+    return true;
+}
+
+bool CatalogImporter::insertCourses(QSqlQuery& query, const QList<Course>& chunk) {
+    if (chunk.isEmpty()) {
+        return true;
+    }
+
+    QVariantList codes, titles, descriptions, credits, classifications, depCodes, types, levels;
+    for (const Course& course : chunk) {
+        codes << course.code;
+        titles << course.title;
+        descriptions << course.description;
+        credits << course.credits;
+        classifications << course.classification;
+        depCodes << course.depCode;
+        types << course.type;
+        levels << course.level;
+    }
+
+    query.addBindValue(codes);
+    query.addBindValue(titles);
+    query.addBindValue(descriptions);
+    query.addBindValue(credits);
+    query.addBindValue(classifications);
+    query.addBindValue(depCodes);
+    query.addBindValue(types);
+    query.addBindValue(levels);
+
+    if (!query.execBatch()) {
+        qDebug() << "Failed to insert courses:" << query.lastError().text();
+        return false;
+    }
+
+    return true;
+}
+
+bool CatalogImporter::importPrerequisites(QSqlDatabase& db, const QString& path,
+                                          ImportStats* stats, int chunkSize) {
+    RecordReader reader(path, QStringList() << "course_code" << "prereq"
+                                            << "prereq_is_corequisite");
+    if (!reader.open()) {
+        qDebug() << "Cannot read prerequisites:" << reader.errorString();
+        return false;
+    }
+
+    ImportStats local;
+    ImportStats& result = stats ? *stats : local;
+    result = ImportStats();
+
+    QElapsedTimer timer;
+    timer.start();
+
+    if (!db.transaction()) {
+        qDebug() << "Failed to begin transaction:" << db.lastError().text();
+        return false;
+    }
+
+    QSqlQuery query(db);
+    query.prepare("INSERT OR REPLACE INTO course_prereq (course_code, prereq, prereq_is_corequisite) VALUES (?, ?, ?)");
+
+    QVariantList courseCodes;
+    QVariantList prereqCodes;
+    QVariantList isCorequisite;
+
+    auto flush = [&]() {
+        if (courseCodes.isEmpty()) {
+            return true;
+        }
+        query.addBindValue(courseCodes);
+        query.addBindValue(prereqCodes);
+        query.addBindValue(isCorequisite);
+        if (!query.execBatch()) {
+            qDebug() << "Failed to insert prerequisites:" << query.lastError().text();
+            return false;
+        }
+        result.rows += courseCodes.size();
+        courseCodes.clear();
+        prereqCodes.clear();
+        isCorequisite.clear();
+        return true;
+    };
+
+    QStringList values;
+    while (reader.next(values)) {
+        if (values.at(0).isEmpty() || values.at(1).isEmpty()) {
+            qDebug() << "Invalid prerequisite record after" << result.rows << "rows";
+            db.rollback();
+            return false;
+        }
+
+        courseCodes << values.at(0);
+        prereqCodes << values.at(1);
+        // JSON booleans come through as "true"/"false"
+        isCorequisite << (values.at(2) == "1" || values.at(2) == "true" ? 1 : 0);
+
+        if (courseCodes.size() == chunkSize && !flush()) {
+            db.rollback();
+            return false;
+        }
+    }
+
+    if (!reader.errorString().isEmpty() || !flush()) {
+        qDebug() << "Prerequisite import failed:" << reader.errorString();
+        db.rollback();
+        return false;
+    }
+
+    if (!db.commit()) {
+        qDebug() << "Failed to commit prerequisite import:" << db.lastError().text();
+        db.rollback();
+        return false;
+    }
+
+    reportThroughput("prerequisites", result, timer);
+    // Only the courses whose chains went through a new edge are recomputed
+    PrerequisiteGraph::refresh();
+    return true;
+}
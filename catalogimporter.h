@@ -0,0 +1,39 @@
+#ifndef CATALOGIMPORTER_H
+#define CATALOGIMPORTER_H
+
+#include "databaseinitializer.h"
+
+#include <QSqlDatabase>
+#include <QSqlQuery>
+#include <QString>
+
+struct ImportStats {
+    qint64 rows = 0;
+    qint64 elapsedMs = 0;
+
+    double rowsPerSecond() const {
+        return elapsedMs > 0 ? rows * 1000.0 / elapsedMs : rows;
+    }
+};
+
+// Streams a catalog from a CSV file (header row required) or a JSON Lines
+// file (one object per line) into the course and course_prereq tables.
+// Only one chunk of rows is held in memory at a time; each file is imported
+// in a single transaction and rolled back on the first bad row.
+class CatalogImporter
+{
+public:
+    static const int defaultChunkSize = 1000;
+
+    static bool importCourses(QSqlDatabase& db, const QString& path,
+                              ImportStats* stats = nullptr,
+                              int chunkSize = defaultChunkSize);
+    static bool importPrerequisites(QSqlDatabase& db, const QString& path,
+                                    ImportStats* stats = nullptr,
+                                    int chunkSize = defaultChunkSize);
+
+private:
+    static bool insertCourses(QSqlQuery& query, const QList<Course>& chunk);
+};
+
+#endif // CATALOGIMPORTER_H
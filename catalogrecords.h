@@ -0,0 +1,50 @@
+#ifndef CATALOGRECORDS_H
+#define CATALOGRECORDS_H
+
+#include <string_view>
+
+// Rows of the compiled-in catalog. catalogdata.h, generated from
+// catalog/*.csv by catalog/codegen.sql, holds constexpr arrays of these; the
+// string_views point into the binary's read-only data, so the tables need
+// neither heap allocation nor static initialisation.
+namespace CatalogData {
+
+struct School {
+    std::string_view code;
+    std::string_view name;
+};
+
+struct Department {
+    std::string_view code;
+    std::string_view title;
+    std::string_view schoolCode;
+};
+
+struct Course {
+    std::string_view code;
+    std::string_view title;
+    std::string_view description;
+    int credits;
+    std::string_view classification;
+    std::string_view depCode;
+    std::string_view type;
+    std::string_view level;
+};
+
+struct Major {
+    int id;
+    std::string_view code;
+    std::string_view name;
+    std::string_view departmentCode;
+    int creditRequirements;
+};
+
+struct Prerequisite {
+    std::string_view courseCode;
+    std::string_view prereq;
+    bool corequisite;
+};
+
+} // namespace CatalogData
+
+#endif // CATALOGRECORDS_H
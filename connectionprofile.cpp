@@ -0,0 +1,268 @@
+#include "connectionprofile.h"
+#include "databaseinitializer.h"
+#include "planqueries.h"
+#include <QSqlQuery>
+#include <QSqlError>
+#include <QDebug>
+#include <QDir>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QFileInfo>
+#include <QRegularExpression>
+#include <QSettings>
+#include <QTemporaryDir>
+#include <QTextStream>
+
+ConnectionProfile ConnectionProfile::interactive() {
+    ConnectionProfile profile;
+    profile.name = "interactive";
+    profile.journalMode = "WAL";
+    profile.synchronous = "NORMAL";
+    profile.mmapSize = 64 * 1024 * 1024;
+    profile.cacheSize = -8 * 1024;
+    profile.tempStore = "MEMORY";
+    return profile;
+}
+
+ConnectionProfile ConnectionProfile::bulkImport() {
+    ConnectionProfile profile;
+    profile.name = "bulk";
+    profile.journalMode = "MEMORY";
+    profile.synchronous = "OFF";
+    profile.mmapSize = 256 * 1024 * 1024;
+    profile.cacheSize = -64 * 1024;
+    profile.tempStore = "MEMORY";
+    return profile;
+}
+
+bool ConnectionProfile::fromName(const QString& name, ConnectionProfile& profile) {
+    if (name.compare("interactive", Qt::CaseInsensitive) == 0) {
+        profile = interactive();
+        return true;
+    }
+    if (name.compare("bulk", Qt::CaseInsensitive) == 0
+        || name.compare("bulk-import", Qt::CaseInsensitive) == 0) {
+        profile = bulkImport();
+        return true;
+    }
+    return false;
+}
+
+// Pragma values can't be bound as parameters, so everything read from the
+// config file is checked against the keywords SQLite accepts
+static QString keywordSetting(QSettings& settings, const QString& key,
+                              const QStringList& allowed, const QString& fallback) {
+    QString value = settings.value(key, fallback).toString().toUpper();
+    if (!allowed.contains(value)) {
+        qDebug() << "Ignoring invalid" << key << "=" << value;
+        return fallback;
+    }
+    return value;
+}
+
+static qint64 numberSetting(QSettings& settings, const QString& key, qint64 fallback) {
+    bool ok = false;
+    qint64 value = settings.value(key, fallback).toLongLong(&ok);
+    if (!ok) {
+        qDebug() << "Ignoring invalid" << key << "=" << settings.value(key).toString();
+        return fallback;
+    }
+    return value;
+}
+
+ConnectionProfile ConnectionProfile::load(const QString& configPath, const QString& overrideName) {
+    ConnectionProfile profile = interactive();
+
+    if (!overrideName.isEmpty()) {
+        if (!fromName(overrideName, profile)) {
+            qDebug() << "Unknown connection profile" << overrideName << "- using interactive";
+        }
+        return profile;
+    }
+
+    if (!QFile::exists(configPath)) {
+        return profile;
+    }
+
+    QSettings settings(configPath, QSettings::IniFormat);
+    settings.beginGroup("database");
+
+    QString name = settings.value("profile", profile.name).toString();
+    if (!fromName(name, profile)) {
+        qDebug() << "Unknown connection profile" << name << "- using interactive";
+    }
+
+    profile.journalMode = keywordSetting(settings, "journal_mode",
+                                         {"DELETE", "TRUNCATE", "PERSIST", "MEMORY", "WAL", "OFF"},
+                                         profile.journalMode);
+    profile.synchronous = keywordSetting(settings, "synchronous",
+                                         {"OFF", "NORMAL", "FULL", "EXTRA"},
+                                         profile.synchronous);
+    profile.tempStore = keywordSetting(settings, "temp_store",
+                                       {"DEFAULT", "FILE", "MEMORY"},
+                                       profile.tempStore);
+    profile.mmapSize = numberSetting(settings, "mmap_size", profile.mmapSize);
+    profile.cacheSize = static_cast<int>(numberSetting(settings, "cache_size", profile.cacheSize));
+
+    return profile;
+}
+
+bool ConnectionProfile::apply(QSqlDatabase& db) const {
+    QSqlQuery query(db);
+
+    // journal_mode would otherwise also try to switch attached databases
+    const QStringList pragmas = {
+        "PRAGMA main.journal_mode = " + journalMode,
+        "PRAGMA synchronous = " + synchronous,
+        "PRAGMA mmap_size = " + QString::number(mmapSize),
+        "PRAGMA cache_size = " + QString::number(cacheSize),
+        "PRAGMA temp_store = " + tempStore,
+    };
+
+    for (const QString& pragma : pragmas) {
+        if (!query.exec(pragma)) {
+            qDebug() << "Failed to apply" << pragma << ":" << query.lastError().text();
+            return false;
+        }
+    }
+
+    qDebug() << "Applied connection profile" << name;
+    return true;
+}
+
+namespace {
+
+int runPlanQuery(QSqlDatabase& db, const char* sql, const QVariantMap& values) {
+    static const QRegularExpression placeholder(":\\w+");
+
+    QSqlQuery query(db);
+    query.prepare(sql);
+    QRegularExpressionMatchIterator it = placeholder.globalMatch(sql);
+    while (it.hasNext()) {
+        QString name = it.next().captured();
+        query.bindValue(name, values.value(name));
+    }
+
+    if (!query.exec()) {
+        qDebug() << "Benchmark query failed:" << query.lastError().text();
+        return 0;
+    }
+
+    int rows = 0;
+    while (query.next()) {
+        ++rows;
+    }
+    return rows;
+}
+
+// What MainWindow::refreshWindow asks the database for after the plan
+// changed, without the widgets
+void runReadWorkload(QSqlDatabase& db, const QVariantMap& values) {
+    runPlanQuery(db, PlanQueries::planProfile, values);
+    runPlanQuery(db, PlanQueries::planCards, values);
+}
+
+// One autocommit UPDATE per course, as EditCourseDetails issues them
+void runWriteWorkload(QSqlDatabase& db, const QList<QPair<QString, QString> >& planned) {
+    QSqlQuery query(db);
+    query.prepare("Update course_planning set grade = grade where course_code = ?");
+    for (const QPair<QString, QString>& course : planned) {
+        query.addBindValue(course.first);
+        query.exec();
+    }
+}
+
+// A consistent copy of the database, including what a WAL profile still
+// keeps in the -wal file, without checkpointing the user's database
+bool copyDatabase(const QString& dbPath, const QString& copyPath) {
+    const QString connection = QStringLiteral("benchmark-source");
+    bool ok = false;
+    {
+        QSqlDatabase source = QSqlDatabase::addDatabase("QSQLITE", connection);
+        source.setDatabaseName(dbPath);
+        if (source.open()) {
+            QSqlQuery query(source);
+            query.prepare("VACUUM INTO ?");
+            query.addBindValue(copyPath);
+            ok = query.exec();
+            if (!ok) {
+                qDebug() << "Failed to copy database:" << query.lastError().text();
+            }
+        } else {
+            qDebug() << "Cannot open database:" << source.lastError().text();
+        }
+        source.close();
+    }
+    QSqlDatabase::removeDatabase(connection);
+    return ok;
+}
+
+} // namespace
+
+int benchmarkConnectionProfiles(const QString& dbPath, const QList<ConnectionProfile>& profiles, int rounds) {
+    QTextStream out(stdout);
+    QTemporaryDir scratch;
+    if (!scratch.isValid()) {
+        out << "Cannot create a scratch directory\n";
+        return 1;
+    }
+
+    out << "profile        reads/round (ms)   writes/round (ms)\n";
+
+    for (const ConnectionProfile& profile : profiles) {
+        // Work on a fresh copy so the benchmark never writes to the user's plan
+        QString copyPath = QDir(scratch.path()).filePath(profile.name + ".db");
+        if (!copyDatabase(dbPath, copyPath)) {
+            out << "Cannot copy " << dbPath << "\n";
+            return 1;
+        }
+
+        {
+            if (!DatabaseInitializer::initializeDatabase(copyPath, profile)) {
+                out << "Cannot open " << copyPath << "\n";
+                return 1;
+            }
+            QSqlDatabase db = QSqlDatabase::database();
+
+            QSqlQuery query(db);
+            query.exec("SELECT id FROM profile LIMIT 1");
+            QVariantMap values;
+            if (query.next()) {
+                values[":profile_id"] = query.value(0);
+            }
+
+            QList<QPair<QString, QString> > planned;
+            query.prepare("SELECT course_code, sem_code FROM course_planning WHERE profile_id = ?");
+            query.addBindValue(values.value(":profile_id"));
+            query.exec();
+            while (query.next()) {
+                planned.append(qMakePair(query.value(0).toString(), query.value(1).toString()));
+            }
+            query.finish();
+
+            QElapsedTimer timer;
+            timer.start();
+            for (int round = 0; round < rounds; ++round) {
+                runReadWorkload(db, values);
+            }
+            double readMs = timer.nsecsElapsed() / 1e6 / rounds;
+
+            timer.restart();
+            for (int round = 0; round < rounds; ++round) {
+                runWriteWorkload(db, planned);
+            }
+            double writeMs = timer.nsecsElapsed() / 1e6 / rounds;
+
+            out << qSetFieldWidth(15) << Qt::left << profile.name
+                << qSetFieldWidth(19) << QString::number(readMs, 'f', 3)
+                << qSetFieldWidth(0) << QString::number(writeMs, 'f', 3)
+                << " (" << planned.size() << " planned courses)\n";
+            out.flush();
+
+            db.close();
+        }
+        QSqlDatabase::removeDatabase(QSqlDatabase::defaultConnection);
+    }
+
+    return 0;
+}
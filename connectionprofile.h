@@ -0,0 +1,47 @@
+#ifndef CONNECTIONPROFILE_H
+#define CONNECTIONPROFILE_H
+
+#include <QList>
+#include <QSqlDatabase>
+#include <QString>
+
+// SQLite pragmas applied to a connection right after it opens.
+//
+// The active profile comes from the [database] group of DegreePlanner.ini
+// next to the executable, where "profile" picks a preset and the remaining
+// keys override single pragmas:
+//
+//   [database]
+//   profile=interactive
+//   journal_mode=WAL
+//   synchronous=NORMAL
+//   mmap_size=67108864
+//   cache_size=-8192
+//   temp_store=MEMORY
+//
+// --db-profile on the command line takes precedence over the file.
+struct ConnectionProfile {
+    QString name;
+    QString journalMode;
+    QString synchronous;
+    qint64 mmapSize;        // bytes, 0 disables memory mapping
+    int cacheSize;          // pages, or KiB when negative
+    QString tempStore;
+
+    // WAL with NORMAL sync: readers never block the UI and commits skip
+    // the per-transaction fsync of the rollback journal
+    static ConnectionProfile interactive();
+    // Journal kept in memory and no syncs; only for rebuildable databases
+    static ConnectionProfile bulkImport();
+
+    static bool fromName(const QString& name, ConnectionProfile& profile);
+    static ConnectionProfile load(const QString& configPath, const QString& overrideName = QString());
+
+    bool apply(QSqlDatabase& db) const;
+};
+
+// Replays the main window's refresh queries, plus one write per planned
+// course, against a copy of dbPath under each profile and prints timings.
+int benchmarkConnectionProfiles(const QString& dbPath, const QList<ConnectionProfile>& profiles, int rounds);
+
+#endif // CONNECTIONPROFILE_H
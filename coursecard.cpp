@@ -0,0 +1,55 @@
+#include "coursecard.h"
+#include "planqueries.h"
+#include <QSqlQuery>
+#include <QSqlError>
+#include <QDebug>
+
+static CourseCard readCard(const QSqlQuery& query) {
+    CourseCard card;
+    card.code = query.value("course_code").toString();
+    card.semOrdinal = query.value("sem_ordinal").toInt();
+    card.title = query.value("course_title").toString();
+    card.credits = query.value("course_credits").toInt();
+    card.level = query.value("course_level").toString();
+    card.grade = query.value("grade").toString();
+    card.done = query.value("is_done_course").toBool();
+    card.current = query.value("is_current_course").toBool();
+    card.planned = query.value("is_planned_course").toBool();
+    return card;
+}
+
+bool CourseCard::loadPlan(int profileId, QHash<int, QList<CourseCard>>& cards) {
+    cards.clear();
+    QSqlQuery query;
+    query.setForwardOnly(true);
+    query.prepare(PlanQueries::planCards);
+    query.bindValue(":profile_id", profileId);
+    if (!query.exec()) {
+        qDebug() << "Failed to read course cards:" << query.lastError().text();
+        return false;
+    }
+    while (query.next()) {
+        CourseCard card = readCard(query);
+        cards[card.semOrdinal].append(card);
+    }
+    return true;
+}
+
+bool CourseCard::load(const QString& courseCode, CourseCard& card) {
+    QSqlQuery query;
+    query.setForwardOnly(true);
+    query.prepare(PlanQueries::courseCard);
+    query.bindValue(":course_code", courseCode);
+    if (!query.exec()) {
+        qDebug() << "Failed to read course card:" << query.lastError().text();
+        return false;
+    }
+    if (!query.next()) {
+        qDebug() << "No course found with code:" << courseCode;
+        card = CourseCard();
+        card.code = courseCode;
+        return false;
+    }
+    card = readCard(query);
+    return true;
+}
@@ -0,0 +1,38 @@
+#ifndef COURSECARD_H
+#define COURSECARD_H
+
+#include <QHash>
+#include <QList>
+#include <QMetaType>
+#include <QString>
+
+// Everything a course card in MainWindow shows, read with the catalog
+// columns joined in rather than one query per label
+struct CourseCard {
+    QString code;
+    int semOrdinal = -1;
+    QString title;
+    int credits = 0;
+    QString level;
+    QString grade;
+    bool done = false;
+    bool current = false;
+    bool planned = false;
+
+    bool operator==(const CourseCard& other) const {
+        return code == other.code && semOrdinal == other.semOrdinal && title == other.title
+            && credits == other.credits && level == other.level && grade == other.grade
+            && done == other.done && current == other.current && planned == other.planned;
+    }
+    bool operator!=(const CourseCard& other) const { return !(*this == other); }
+
+    // Every card of the profile's plan in one query, by Semester::ordinal()
+    // and in the order the semester lists them; cards is left empty on error
+    static bool loadPlan(int profileId, QHash<int, QList<CourseCard>>& cards);
+    // A single card, for a course just added to the plan
+    static bool load(const QString& courseCode, CourseCard& card);
+};
+
+Q_DECLARE_METATYPE(CourseCard)
+
+#endif // COURSECARD_H
@@ -0,0 +1,165 @@
+#include "coursecarddelegate.h"
+#include "planmodel.h"
+#include <QIcon>
+#include <QMouseEvent>
+#include <QPainter>
+#include <QPainterPath>
+
+static const int cardMargin = 4;
+static const int buttonSize = 28;
+
+CourseCardDelegate::CourseCardDelegate(QObject* parent)
+    : QStyledItemDelegate(parent)
+{
+}
+
+CourseCardDelegate::Status CourseCardDelegate::status(const CourseCard& card, bool violated) {
+    Status status;
+    if (card.done) {
+        status = {"Completed", QColor("#4CAF50"), QColor("#388E3C")};
+    } else if (card.current) {
+        status = {"Current", QColor("#2196F3"), QColor("#1976D2")};
+    } else if (card.planned) {
+        status = {"Planned", QColor("#9C27B0"), QColor("#7B1FA2")};
+    } else {
+        status = {"Null", QColor(Qt::transparent), QColor(Qt::transparent)};
+    }
+    if (violated) {
+        status.fill = QColor("#F44336");
+        status.border = QColor("#D32F2F");
+    }
+    return status;
+}
+
+QRect CourseCardDelegate::deleteButtonRect(const QStyleOptionViewItem& option) const {
+    QRect card = option.rect.adjusted(cardMargin, cardMargin, -cardMargin, -cardMargin);
+    return QRect(card.right() - 12 - buttonSize, card.top() + 18, buttonSize, buttonSize);
+}
+
+QRect CourseCardDelegate::editButtonRect(const QStyleOptionViewItem& option) const {
+    return deleteButtonRect(option).translated(-buttonSize - 6, 0);
+}
+
+void CourseCardDelegate::paint(QPainter* painter, const QStyleOptionViewItem& option,
+                               const QModelIndex& index) const {
+    CourseCard card = qvariant_cast<CourseCard>(index.data(PlanModel::CardRole));
+    bool violated = !index.data(PlanModel::ViolationsRole).toStringList().isEmpty();
+    bool hovered = option.state & QStyle::State_MouseOver;
+
+    painter->save();
+    painter->setRenderHint(QPainter::Antialiasing);
+
+    QRect frame = option.rect.adjusted(cardMargin, cardMargin, -cardMargin, -cardMargin);
+    painter->setPen(QPen(option.palette.color(hovered ? QPalette::Midlight : QPalette::Mid), 1));
+    painter->setBrush(option.palette.window());
+    painter->drawRoundedRect(QRectF(frame).adjusted(0.5, 0.5, -0.5, -0.5), 6, 6);
+
+    QRect content = frame.adjusted(12, 8, -12, -8);
+
+    // Code and status on the title row
+    QFont codeFont("Segoe UI", 19, QFont::Bold);
+    QFontMetrics codeMetrics(codeFont);
+    QRect titleRow(content.left(), content.top(), content.width(), 48);
+    painter->setFont(codeFont);
+    painter->setPen(option.palette.color(QPalette::WindowText));
+    int codeWidth = codeMetrics.horizontalAdvance(card.code);
+    painter->drawText(QRect(titleRow.left(), titleRow.top(), codeWidth, titleRow.height()),
+                      Qt::AlignLeft | Qt::AlignVCenter, card.code);
+
+    Status pill = status(card, violated);
+    QFont pillFont(option.font);
+    pillFont.setBold(true);
+    pillFont.setPixelSize(14);
+    QFontMetrics pillMetrics(pillFont);
+    QRect pillRect(titleRow.left() + codeWidth + 12, titleRow.center().y() - 16,
+                   pillMetrics.horizontalAdvance(pill.text) + 24, 33);
+    painter->setPen(QPen(pill.border, 1));
+    painter->setBrush(pill.fill);
+    painter->drawRoundedRect(QRectF(pillRect).adjusted(0.5, 0.5, -0.5, -0.5), 8, 8);
+    painter->setFont(pillFont);
+    painter->setPen(Qt::white);
+    painter->drawText(pillRect, Qt::AlignCenter, pill.text);
+
+    if (hovered) {
+        static const QIcon editIcon(":icons/edit.png");
+        static const QIcon deleteIcon(":icons/delete.png");
+        for (const auto& button : {qMakePair(editButtonRect(option), &editIcon),
+                                   qMakePair(deleteButtonRect(option), &deleteIcon)}) {
+            painter->setPen(QColor(0, 0, 0, 50));
+            painter->setBrush(QColor(0, 0, 0, 30));
+            painter->drawRoundedRect(QRectF(button.first).adjusted(0.5, 0.5, -0.5, -0.5), 4, 4);
+            button.second->paint(painter, button.first.adjusted(6, 6, -6, -6));
+        }
+    }
+
+    // Title, then credits, level and grade
+    painter->setFont(option.font);
+    painter->setPen(option.palette.color(QPalette::WindowText));
+    QFontMetrics metrics(option.font);
+    QRect descRect(content.left(), titleRow.bottom() + 8, content.width(), metrics.height());
+    painter->drawText(descRect, Qt::AlignLeft | Qt::AlignVCenter,
+                      metrics.elidedText(card.title, Qt::ElideRight, descRect.width()));
+
+    QRect footer(content.left(), content.bottom() - metrics.height() - 6, qMin(214, content.width()),
+                 metrics.height());
+    int x = footer.left();
+    for (const QString& text : {QString::number(card.credits) + " credits", card.level,
+                                "Grade: " + card.grade}) {
+        int width = metrics.horizontalAdvance(text);
+        painter->drawText(QRect(x, footer.top(), width, footer.height()), Qt::AlignLeft | Qt::AlignVCenter, text);
+        x += width + 18;
+    }
+
+    painter->restore();
+}
+
+QSize CourseCardDelegate::sizeHint(const QStyleOptionViewItem& option, const QModelIndex&) const {
+    return QSize(qMax(option.rect.width(), 300), cardHeight);
+}
+
+bool CourseCardDelegate::editorEvent(QEvent* event, QAbstractItemModel* model,
+                                     const QStyleOptionViewItem& option, const QModelIndex& index) {
+    if (event->type() == QEvent::MouseButtonRelease) {
+        QMouseEvent* mouse = static_cast<QMouseEvent*>(event);
+        QString code = index.data(Qt::DisplayRole).toString();
+        if (mouse->button() == Qt::LeftButton && editButtonRect(option).contains(mouse->position().toPoint())) {
+            emit editRequested(code);
+            return true;
+        }
+        if (mouse->button() == Qt::LeftButton && deleteButtonRect(option).contains(mouse->position().toPoint())) {
+            emit deleteRequested(code);
+            return true;
+        }
+    }
+    return QStyledItemDelegate::editorEvent(event, model, option, index);
+}
+
+CourseCardView::CourseCardView(QAbstractItemModel* model, CourseCardDelegate* delegate, QWidget* parent)
+    : QListView(parent)
+{
+    setModel(model);
+    setItemDelegate(delegate);
+    setUniformItemSizes(true);
+    setSelectionMode(QAbstractItemView::NoSelection);
+    setFocusPolicy(Qt::NoFocus);
+    setFrameShape(QFrame::NoFrame);
+    setHorizontalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
+    setVerticalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
+    setSizePolicy(QSizePolicy::Expanding, QSizePolicy::Fixed);
+    setMouseTracking(true);
+    viewport()->setAttribute(Qt::WA_Hover);
+    setStyleSheet("QListView { background: transparent; }");
+
+    connect(model, &QAbstractItemModel::rowsInserted, this, [this]() { updateGeometry(); });
+    connect(model, &QAbstractItemModel::rowsRemoved, this, [this]() { updateGeometry(); });
+    connect(model, &QAbstractItemModel::modelReset, this, [this]() { updateGeometry(); });
+}
+
+QSize CourseCardView::sizeHint() const {
+    int rows = model() ? model()->rowCount(rootIndex()) : 0;
+    return QSize(QListView::sizeHint().width(), rows * CourseCardDelegate::cardHeight);
+}
+
+QSize CourseCardView::minimumSizeHint() const {
+    return QSize(0, sizeHint().height());
+}
@@ -0,0 +1,60 @@
+#ifndef COURSECARDDELEGATE_H
+#define COURSECARDDELEGATE_H
+
+#include "coursecard.h"
+
+#include <QColor>
+#include <QListView>
+#include <QStyledItemDelegate>
+
+// Paints a PlanModel card the way the card widgets used to look: the code
+// and status pill on top, the title under them and credits, level and grade
+// along the bottom. Edit and delete show while the card is hovered; they are
+// painted too, so a card costs no widgets at all.
+class CourseCardDelegate : public QStyledItemDelegate
+{
+    Q_OBJECT
+
+public:
+    static constexpr int cardHeight = 143;
+
+    explicit CourseCardDelegate(QObject* parent = nullptr);
+
+    void paint(QPainter* painter, const QStyleOptionViewItem& option, const QModelIndex& index) const override;
+    QSize sizeHint(const QStyleOptionViewItem& option, const QModelIndex& index) const override;
+
+    // Text and colours of a card's status pill
+    struct Status {
+        QString text;
+        QColor fill;
+        QColor border;
+    };
+    static Status status(const CourseCard& card, bool violated);
+
+signals:
+    void editRequested(const QString& courseCode);
+    void deleteRequested(const QString& courseCode);
+
+protected:
+    bool editorEvent(QEvent* event, QAbstractItemModel* model, const QStyleOptionViewItem& option,
+                     const QModelIndex& index) override;
+
+private:
+    QRect editButtonRect(const QStyleOptionViewItem& option) const;
+    QRect deleteButtonRect(const QStyleOptionViewItem& option) const;
+};
+
+// One semester's cards. It never scrolls: its height follows the number of
+// cards under its root index, so the semester frame around it grows with it.
+class CourseCardView : public QListView
+{
+    Q_OBJECT
+
+public:
+    CourseCardView(QAbstractItemModel* model, CourseCardDelegate* delegate, QWidget* parent = nullptr);
+
+    QSize sizeHint() const override;
+    QSize minimumSizeHint() const override;
+};
+
+#endif // COURSECARDDELEGATE_H
@@ -1,5 +1,8 @@
 #include "coursedetails.h"
+#include "courseplan.h"
 #include "global_objects.h"
+#include "planqueries.h"
+#include "prerequisitegraph.h"
 #include "qpushbutton.h"
 #include "qsqlerror.h"
 #include "qsqlquery.h"
@@ -10,9 +13,10 @@
 #include <QMessageBox>
 #include <QMouseEvent>
 
-CourseDetails::CourseDetails(QString semester, QWidget *parent)
+CourseDetails::CourseDetails(const Semester &semester, const CoursePlan &plan, QWidget *parent)
     : QDialog(parent)
     , ui(new Ui::CourseDetails)
+    , plan(plan)
 {
     ui->setupUi(this);
 
@@ -20,7 +24,7 @@ CourseDetails::CourseDetails(QString semester, QWidget *parent)
 
     ui->buttonBox->button(QDialogButtonBox::Ok)->setDisabled(1);
 
-    ui->label_2->setText(semester);
+    ui->label_2->setText(semester.title());
     ui->course_title->setReadOnly(1);
     ui->spinBox->setReadOnly(1);
 
@@ -85,12 +89,21 @@ CourseDetails::~CourseDetails()
 }
 
 void CourseDetails::populateCoursesCombobox(){
+    const PrerequisiteGraph &graph = PrerequisiteGraph::active();
     QSqlQuery query;
-    query.exec("Select course_code from course "
-               "where course_code NOT IN (select cp.course_code from course_planning cp)");
+    query.exec(PlanQueries::unplannedCourses);
     while(query.next()){
         QString course = query.value(0).toString();
         ui->comboBox->addItem(course);
+        int id = graph.courseId(course);
+        if(id >= 0){
+            ui->comboBox->setItemData(ui->comboBox->count() - 1,
+                                      QString("Needs %1 courses over at least %2 semesters, unlocks %3")
+                                          .arg(graph.allPrerequisites(id).count())
+                                          .arg(graph.minimumSemesters(id))
+                                          .arg(graph.unlocks(id).count()),
+                                      Qt::ToolTipRole);
+        }
     }
 }
 
@@ -100,7 +113,7 @@ void CourseDetails::on_comboBox_currentIndexChanged(int index)
     this->course_code = course;
 
     QSqlQuery query;
-    query.prepare("Select course_title, course_credits from course where course_code = :course");
+    query.prepare(PlanQueries::courseSummary);
     query.bindValue(":course", course);
     query.exec();
     query.next();
@@ -125,11 +138,22 @@ QString CourseDetails::getCourseCode(){
 
 void CourseDetails::on_buttonBox_accepted()
 {
+    const PrerequisiteGraph &graph = PrerequisiteGraph::active();
+    QStringList errors;
+    for(const PlanViolation &violation : plan.check(graph.courseId(course_code), semester)){
+        errors.append(violation.message(graph));
+    }
+    if(!errors.isEmpty()){
+        showError("You dont have the required prerequisites:\n" + errors.join("\n"));
+        reject();
+        return;
+    }
+
     QSqlQuery query;
-    query.prepare("Insert into course_planning (course_code, sem_code, is_current_course, is_planned_course, is_done_course, grade, profile_id) "
-                  "VALUES (:course_code, :sem_code, :is_current_course, :is_planned_course, :is_done_course, :grade, :profile_id)");
+    query.prepare(PlanQueries::insertPlannedCourse);
     query.bindValue(":course_code", course_code);
-    query.bindValue(":sem_code", semester.remove(" "));
+    query.bindValue(":sem_code", semester.code());
+    query.bindValue(":sem_ordinal", semester.ordinal());
     query.bindValue(":is_current_course", is_current_course);
     query.bindValue(":is_planned_course", is_planned_course);
     query.bindValue(":is_done_course", is_done_course);
@@ -138,38 +162,42 @@ void CourseDetails::on_buttonBox_accepted()
     query.exec();
 
     if(query.lastError().isValid()){
-        QMessageBox msgBox;
-        msgBox.setWindowTitle("Error");
-        msgBox.setText(query.lastError().text());
-        msgBox.setIcon(QMessageBox::Critical);
-
-        // Apply style sheet
-        msgBox.setStyleSheet(
-            "QMessageBox { "
-            "   background-color: #2b2b2b; "
-            "   color: white; "
-            "}"
-            "QMessageBox QLabel { "
-            "   color: white; "
-            "   font-size: 14px; "
-            "}"
-            "QMessageBox QPushButton { "
-            "   background-color: #0078d4; "
-            "   color: white; "
-            "   border: none; "
-            "   padding: 8px 16px; "
-            "   border-radius: 4px; "
-            "   min-width: 80px; "
-            "}"
-            "QMessageBox QPushButton:hover { "
-            "   background-color: #106ebe; "
-            "}"
-            );
-
-        msgBox.exec();
-
+        showError(query.lastError().text());
         reject();
-    }
+    } else ++plan_revision;
+}
+
+void CourseDetails::showError(const QString &message)
+{
+    QMessageBox msgBox;
+    msgBox.setWindowTitle("Error");
+    msgBox.setText(message);
+    msgBox.setIcon(QMessageBox::Critical);
+
+    // Apply style sheet
+    msgBox.setStyleSheet(
+        "QMessageBox { "
+        "   background-color: #2b2b2b; "
+        "   color: white; "
+        "}"
+        "QMessageBox QLabel { "
+        "   color: white; "
+        "   font-size: 14px; "
+        "}"
+        "QMessageBox QPushButton { "
+        "   background-color: #0078d4; "
+        "   color: white; "
+        "   border: none; "
+        "   padding: 8px 16px; "
+        "   border-radius: 4px; "
+        "   min-width: 80px; "
+        "}"
+        "QMessageBox QPushButton:hover { "
+        "   background-color: #106ebe; "
+        "}"
+        );
+
+    msgBox.exec();
 }
 
 std::tuple<bool, bool, bool> CourseDetails::getCourseStatus(){
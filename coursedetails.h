@@ -1,6 +1,9 @@
 #ifndef COURSEDETAILS_H
 #define COURSEDETAILS_H
 
+#include "courseplan.h"
+#include "semester.h"
+
 #include <QDialog>
 
 namespace Ui {
@@ -12,7 +15,8 @@ class CourseDetails : public QDialog
     Q_OBJECT
 
 public:
-    explicit CourseDetails(QString semester, QWidget *parent = nullptr);
+    // plan is MainWindow's, checked against before anything is written
+    CourseDetails(const Semester &semester, const CoursePlan &plan, QWidget *parent = nullptr);
     ~CourseDetails();
 
     QString getCourseCode();
@@ -35,13 +39,15 @@ private slots:
 private:
     Ui::CourseDetails *ui;
     QString course_code;
-    QString semester;
+    Semester semester;
+    const CoursePlan &plan;
     int is_current_course = 0;
     int is_done_course = 0;
     int is_planned_course = 0;
     QString grade;
 
     void populateCoursesCombobox();
+    void showError(const QString &message);
 
 protected:
     bool eventFilter(QObject *obj, QEvent *event) override;
@@ -0,0 +1,209 @@
+#include "coursegraphitem.h"
+#include <QDebug>
+#include <QElapsedTimer>
+#include <QGraphicsSceneHoverEvent>
+#include <QPainter>
+#include <QStyleOptionGraphicsItem>
+#include <algorithm>
+#include <cmath>
+
+static std::shared_ptr<const CourseGraphLayout> cachedLayout;
+
+std::shared_ptr<const CourseGraphLayout> CourseGraphLayout::of(const PrerequisiteGraph& graph) {
+    if (cachedLayout && cachedLayout->version == graph.version()) {
+        return cachedLayout;
+    }
+    QElapsedTimer timer;
+    timer.start();
+
+    auto built = std::make_shared<CourseGraphLayout>();
+    CourseGraphLayout& layout = *built;
+    layout.version = graph.version();
+    layout.columnOf.fill(0, graph.courseCount());
+    layout.rowOf.fill(0, graph.courseCount());
+
+    for (int course : graph.order()) {
+        int level = graph.level(course);
+        if (level >= layout.columns.size()) {
+            layout.columns.resize(level + 1);
+        }
+        layout.columnOf[course] = level;
+        layout.rowOf[course] = int(layout.columns[level].size());
+        layout.columns[level].append(course);
+    }
+
+    // One sweep of the barycenter heuristic: every prerequisite sits in an
+    // earlier column, whose rows are final by the time a column is sorted
+    QVector<qreal> barycenter(graph.courseCount(), 0);
+    for (int level = 1; level < layout.columns.size(); ++level) {
+        QVector<int>& column = layout.columns[level];
+        for (int course : column) {
+            qreal sum = 0;
+            for (int prereq : graph.prerequisites(course)) {
+                sum += layout.rowOf[prereq];
+            }
+            barycenter[course] = sum / qMax(1, graph.prerequisites(course).size());
+        }
+        std::stable_sort(column.begin(), column.end(),
+                         [&](int a, int b) { return barycenter[a] < barycenter[b]; });
+        for (int row = 0; row < column.size(); ++row) {
+            layout.rowOf[column[row]] = row;
+        }
+    }
+
+    for (int course = 0; course < graph.courseCount(); ++course) {
+        for (int prereq : graph.prerequisites(course)) {
+            layout.maxSpan = qMax(layout.maxSpan, layout.columnOf[course] - layout.columnOf[prereq]);
+        }
+    }
+
+    int rows = 0;
+    for (const QVector<int>& column : layout.columns) {
+        rows = qMax(rows, int(column.size()));
+    }
+    layout.bounds = QRectF(-columnWidth / 2, -rowHeight / 2,
+                           qMax(1, int(layout.columns.size())) * columnWidth,
+                           qMax(1, rows) * rowHeight);
+
+    qDebug() << "Laid out" << graph.courseCount() << "courses in" << layout.columns.size()
+             << "columns in" << timer.elapsed() << "ms";
+    cachedLayout = built;
+    return cachedLayout;
+}
+
+int CourseGraphLayout::courseAt(const QPointF& pos) const {
+    int column = qRound(pos.x() / columnWidth);
+    int row = qRound(pos.y() / rowHeight);
+    if (column < 0 || column >= columns.size() || row < 0 || row >= columns[column].size()) {
+        return -1;
+    }
+    int course = columns[column][row];
+    return nodeRect(course).contains(pos) ? course : -1;
+}
+
+CourseGraphItem::CourseGraphItem(const PrerequisiteGraph& graph)
+    : graph_(graph)
+    , layout_(CourseGraphLayout::of(graph))
+{
+    setFlag(ItemUsesExtendedStyleOption);
+    setAcceptHoverEvents(true);
+}
+
+void CourseGraphItem::setPlan(const CoursePlan* plan) {
+    plan_ = plan;
+    update();
+}
+
+QRectF CourseGraphItem::boundingRect() const {
+    return layout_->bounds;
+}
+
+QColor CourseGraphItem::fillFor(int course) const {
+    if (selected_ >= 0) {
+        if (course == selected_) {
+            return QColor("#FFC107");
+        }
+        if (graph_.allPrerequisites(selected_).contains(course)) {
+            return QColor("#2196F3");
+        }
+        if (graph_.unlocks(selected_).contains(course)) {
+            return QColor("#FF9800");
+        }
+    }
+    if (plan_ && plan_->semesterOf(course).isValid()) {
+        if (plan_->completed().contains(course)) {
+            return QColor("#4CAF50");
+        }
+        return plan_->check(course, plan_->semesterOf(course)).isEmpty() ? QColor("#9C27B0")
+                                                                         : QColor("#F44336");
+    }
+    return QColor("#424245");
+}
+
+void CourseGraphItem::paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget*) {
+    const qreal lod = option->levelOfDetailFromTransform(painter->worldTransform());
+    const QRectF exposed = option->exposedRect;
+
+    // Only the columns and rows inside the exposed rectangle
+    auto columnAt = [](qreal x) { return int(std::floor(x / CourseGraphLayout::columnWidth + 0.5)); };
+    auto rowAt = [](qreal y) { return int(std::floor(y / CourseGraphLayout::rowHeight + 0.5)); };
+    int firstColumn = qMax(0, columnAt(exposed.left()));
+    int lastColumn = qMin(int(layout_->columns.size()) - 1, columnAt(exposed.right()));
+    int firstRow = qMax(0, rowAt(exposed.top()));
+    int lastRow = rowAt(exposed.bottom());
+
+    // Edges run left to right, so one reaching the exposed columns starts
+    // at or before the last of them and ends at or after the first, no
+    // more than the longest edge past it. Far out, only the selected
+    // course's chains are drawn.
+    const bool allEdges = lod > 0.15;
+    QPen edgePen(QColor(160, 160, 160, 90), 0);
+    QPen highlightPen(QColor("#FFC107"), 0);
+    const CourseSet* needs = selected_ >= 0 ? &graph_.allPrerequisites(selected_) : nullptr;
+    const CourseSet* unlocks = selected_ >= 0 ? &graph_.unlocks(selected_) : nullptr;
+    int lastEdgeColumn = qMin(int(layout_->columns.size()) - 1, lastColumn + layout_->maxSpan);
+    for (int column = firstColumn; column <= lastEdgeColumn; ++column) {
+        for (int course : layout_->columns[column]) {
+            QPointF to = layout_->center(course);
+            for (int prereq : graph_.prerequisites(course)) {
+                if (layout_->columnOf[prereq] > lastColumn) {
+                    continue;
+                }
+                bool highlighted = selected_ >= 0
+                    && (((course == selected_ || needs->contains(course)) && needs->contains(prereq))
+                        || ((prereq == selected_ || unlocks->contains(prereq)) && unlocks->contains(course)));
+                if (!allEdges && !highlighted) {
+                    continue;
+                }
+                QPointF from = layout_->center(prereq);
+                if (!QRectF(from, to).normalized().adjusted(-1, -1, 1, 1).intersects(exposed)) {
+                    continue;
+                }
+                painter->setPen(highlighted ? highlightPen : edgePen);
+                painter->drawLine(QPointF(from.x() + CourseGraphLayout::nodeWidth / 2, from.y()),
+                                  QPointF(to.x() - CourseGraphLayout::nodeWidth / 2, to.y()));
+            }
+        }
+    }
+
+    painter->setPen(lod > 0.4 ? QPen(QColor("#1E1E1E"), 0) : Qt::NoPen);
+    QFont font("Segoe UI", 10, QFont::Bold);
+    painter->setFont(font);
+    for (int column = firstColumn; column <= lastColumn; ++column) {
+        const QVector<int>& courses = layout_->columns[column];
+        for (int row = firstRow; row <= qMin(lastRow, int(courses.size()) - 1); ++row) {
+            int course = courses[row];
+            QRectF rect = layout_->nodeRect(course);
+            painter->setBrush(fillFor(course));
+            if (lod > 0.4) {
+                painter->drawRoundedRect(rect, 6, 6);
+            } else {
+                painter->drawRect(rect);
+            }
+            if (lod > 0.6) {
+                painter->setPen(Qt::white);
+                painter->drawText(rect, Qt::AlignCenter, graph_.courseCode(course));
+                painter->setPen(QPen(QColor("#1E1E1E"), 0));
+            }
+        }
+    }
+}
+
+void CourseGraphItem::hoverMoveEvent(QGraphicsSceneHoverEvent* event) {
+    int course = layout_->courseAt(event->pos());
+    if (course < 0) {
+        setToolTip(QString());
+        return;
+    }
+    setToolTip(QString("%1\nNeeds %2 courses over at least %3 semesters\nUnlocks %4 courses")
+                   .arg(graph_.courseCode(course))
+                   .arg(graph_.allPrerequisites(course).count())
+                   .arg(graph_.minimumSemesters(course))
+                   .arg(graph_.unlocks(course).count()));
+}
+
+void CourseGraphItem::toggleSelection(const QPointF& pos) {
+    int course = layout_->courseAt(pos);
+    selected_ = course == selected_ ? -1 : course;
+    update();
+}
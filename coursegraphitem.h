@@ -0,0 +1,76 @@
+#ifndef COURSEGRAPHITEM_H
+#define COURSEGRAPHITEM_H
+
+#include "courseplan.h"
+#include "prerequisitegraph.h"
+
+#include <QColor>
+#include <QGraphicsItem>
+#include <QPointF>
+#include <QRectF>
+#include <QVector>
+#include <memory>
+
+// Courses of a PrerequisiteGraph laid out left to right, one column per
+// level, each column ordered by the mean row of its prerequisites so that
+// edges cross less. Computed once per graph version and shared; an item
+// keeps its layout alive after a reload replaces the cached one.
+struct CourseGraphLayout {
+    static constexpr qreal columnWidth = 200;
+    static constexpr qreal rowHeight = 44;
+    static constexpr qreal nodeWidth = 140;
+    static constexpr qreal nodeHeight = 28;
+
+    int version = 0;
+    QVector<QVector<int>> columns;  // course ids per level, top to bottom
+    QVector<int> columnOf;
+    QVector<int> rowOf;
+    int maxSpan = 0;  // most columns any prerequisite edge crosses
+    QRectF bounds;
+
+    static std::shared_ptr<const CourseGraphLayout> of(const PrerequisiteGraph& graph);
+
+    QPointF center(int course) const {
+        return QPointF(columnOf.at(course) * columnWidth, rowOf.at(course) * rowHeight);
+    }
+    QRectF nodeRect(int course) const {
+        QPointF c = center(course);
+        return QRectF(c.x() - nodeWidth / 2, c.y() - nodeHeight / 2, nodeWidth, nodeHeight);
+    }
+    // -1 when pos isn't on a course
+    int courseAt(const QPointF& pos) const;
+};
+
+// The whole catalog as one item. paint() only walks the courses inside the
+// exposed rectangle and drops detail as the view zooms out: labels, then
+// borders, then edges that aren't highlighted. Nodes are coloured by the
+// plan; selecting one highlights everything it needs and unlocks.
+class CourseGraphItem : public QGraphicsItem
+{
+public:
+    explicit CourseGraphItem(const PrerequisiteGraph& graph);
+
+    int graphVersion() const { return layout_->version; }
+    // Not owned; update() after the plan changes
+    void setPlan(const CoursePlan* plan);
+    // Selects the course at pos, in item coordinates, or clears the
+    // selection when pos is on it again or on no course. The view calls it
+    // on a click, so pressing on a course to pan doesn't change it.
+    void toggleSelection(const QPointF& pos);
+
+    QRectF boundingRect() const override;
+    void paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget) override;
+
+protected:
+    void hoverMoveEvent(QGraphicsSceneHoverEvent* event) override;
+
+private:
+    const PrerequisiteGraph& graph_;
+    std::shared_ptr<const CourseGraphLayout> layout_;
+    const CoursePlan* plan_ = nullptr;
+    int selected_ = -1;
+
+    QColor fillFor(int course) const;
+};
+
+#endif // COURSEGRAPHITEM_H
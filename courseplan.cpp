@@ -0,0 +1,189 @@
+#include "courseplan.h"
+#include "planqueries.h"
+#include <QSqlQuery>
+#include <QSqlError>
+#include <QDebug>
+#include <algorithm>
+
+QString PlanViolation::message(const PrerequisiteGraph& graph) const {
+    QString prereq = graph.courseCode(prerequisite);
+    QString kind = corequisite ? "corequisite" : "prerequisite";
+    if (!prerequisiteSemester.isValid()) {
+        return QString("%1 requires %2 %3, which isn't planned")
+            .arg(graph.courseCode(course), kind, prereq);
+    }
+    return QString("%1 in %2 requires %3 %4, which is planned for %5")
+        .arg(graph.courseCode(course), semester.title(), kind, prereq, prerequisiteSemester.title());
+}
+
+CoursePlan::CoursePlan(const PrerequisiteGraph& graph)
+    : graph_(graph)
+    , ordinalOf_(graph.courseCount(), -1)
+    , completed_(graph.courseCount())
+{
+    rebuild();
+}
+
+bool CoursePlan::load(int profileId) {
+    ordinalOf_.fill(-1);
+    completed_ = CourseSet(graph_.courseCount());
+
+    QSqlQuery query;
+    query.setForwardOnly(true);
+    query.prepare(PlanQueries::planCourses);
+    query.bindValue(":profile_id", profileId);
+    if (!query.exec()) {
+        qDebug() << "Failed to read plan:" << query.lastError().text();
+        rebuild();
+        return false;
+    }
+    while (query.next()) {
+        int course = graph_.courseId(query.value(0).toString());
+        if (course >= 0) {
+            ordinalOf_[course] = query.value(1).toInt();
+            if (query.value(2).toBool()) {
+                completed_.insert(course);
+            }
+        }
+    }
+    rebuild();
+    return true;
+}
+
+void CoursePlan::place(int course, const Semester& semester) {
+    if (course < 0 || !semester.isValid()) {
+        return;
+    }
+    remove(course);
+
+    int k = prefixBefore(semester);
+    if (k == ordinals_.size() || ordinals_[k] != semester.ordinal()) {
+        // A new, empty semester: the prefix after it equals the one before
+        ordinals_.insert(k, semester.ordinal());
+        semesterSizes_.insert(k, 0);
+        CourseSet before = completedBefore_.at(k);
+        completedBefore_.insert(k + 1, before);
+    }
+    ++semesterSizes_[k];
+    for (int j = k + 1; j < completedBefore_.size(); ++j) {
+        completedBefore_[j].insert(course);
+    }
+    ordinalOf_[course] = semester.ordinal();
+}
+
+void CoursePlan::remove(int course) {
+    if (course < 0 || ordinalOf_.at(course) < 0) {
+        return;
+    }
+
+    int k = prefixBefore(semesterOf(course));
+    for (int j = k + 1; j < completedBefore_.size(); ++j) {
+        completedBefore_[j].remove(course);
+    }
+    if (--semesterSizes_[k] == 0) {
+        ordinals_.remove(k);
+        semesterSizes_.remove(k);
+        completedBefore_.remove(k + 1);
+    }
+    ordinalOf_[course] = -1;
+    completed_.remove(course);
+}
+
+void CoursePlan::setCompleted(int course, bool done) {
+    if (course < 0 || ordinalOf_.at(course) < 0) {
+        return;
+    }
+    if (done) {
+        completed_.insert(course);
+    } else {
+        completed_.remove(course);
+    }
+}
+
+Semester CoursePlan::semesterOf(int course) const {
+    return course >= 0 ? Semester::fromOrdinal(ordinalOf_.at(course)) : Semester();
+}
+
+Semester CoursePlan::latestSemester() const {
+    return ordinals_.isEmpty() ? Semester() : Semester::fromOrdinal(ordinals_.last());
+}
+
+void CoursePlan::rebuild() {
+    ordinals_.clear();
+    for (int ordinal : ordinalOf_) {
+        if (ordinal >= 0) {
+            ordinals_.append(ordinal);
+        }
+    }
+    std::sort(ordinals_.begin(), ordinals_.end());
+    ordinals_.erase(std::unique(ordinals_.begin(), ordinals_.end()), ordinals_.end());
+
+    // Each course goes into the prefix right after its own semester, then
+    // every prefix takes in the one before it
+    completedBefore_.fill(CourseSet(graph_.courseCount()), ordinals_.size() + 1);
+    semesterSizes_.fill(0, ordinals_.size());
+    for (int course = 0; course < ordinalOf_.size(); ++course) {
+        if (ordinalOf_[course] >= 0) {
+            int k = prefixBefore(Semester::fromOrdinal(ordinalOf_[course]));
+            completedBefore_[k + 1].insert(course);
+            ++semesterSizes_[k];
+        }
+    }
+    for (int k = 1; k < completedBefore_.size(); ++k) {
+        completedBefore_[k] |= completedBefore_[k - 1];
+    }
+}
+
+int CoursePlan::prefixBefore(const Semester& semester) const {
+    auto it = std::lower_bound(ordinals_.cbegin(), ordinals_.cend(), semester.ordinal());
+    return int(it - ordinals_.cbegin());
+}
+
+QList<PlanViolation> CoursePlan::check(int course, const Semester& semester) const {
+    QList<PlanViolation> violations;
+    if (course < 0) {
+        return violations;
+    }
+
+    // Courses of semester itself are only in the next prefix, and only when
+    // the plan already has that semester
+    int k = prefixBefore(semester);
+    const CourseSet& before = completedBefore_.at(k);
+    bool planned = k < ordinals_.size() && ordinals_.at(k) == semester.ordinal();
+    const CourseSet& through = planned ? completedBefore_.at(k + 1) : before;
+    if (graph_.prerequisiteMask(course).isSubsetOf(before)
+        && graph_.corequisiteMask(course).isSubsetOf(through)) {
+        return violations;
+    }
+
+    for (int prereq : graph_.prerequisites(course)) {
+        bool corequisite = graph_.isCorequisite(course, prereq);
+        if (!(corequisite ? through : before).contains(prereq)) {
+            violations.append({course, prereq, corequisite, semester, semesterOf(prereq)});
+        }
+    }
+    return violations;
+}
+
+QList<PlanViolation> CoursePlan::validate() const {
+    QList<PlanViolation> violations;
+    for (int course = 0; course < ordinalOf_.size(); ++course) {
+        if (ordinalOf_[course] >= 0) {
+            violations += check(course, Semester::fromOrdinal(ordinalOf_[course]));
+        }
+    }
+    return violations;
+}
+
+QList<int> CoursePlan::affectedBy(int course) const {
+    QList<int> affected;
+    if (course < 0) {
+        return affected;
+    }
+    for (int dependent : graph_.dependents(course)) {
+        if (ordinalOf_.at(dependent) >= 0) {
+            affected.append(dependent);
+        }
+    }
+    return affected;
+}
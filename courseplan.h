@@ -0,0 +1,76 @@
+#ifndef COURSEPLAN_H
+#define COURSEPLAN_H
+
+#include "courseset.h"
+#include "prerequisitegraph.h"
+#include "semester.h"
+
+#include <QList>
+#include <QString>
+#include <QVector>
+
+// A prerequisite that isn't planned before the course needing it, or a
+// corequisite planned after it
+struct PlanViolation {
+    int course;
+    int prerequisite;
+    bool corequisite;
+    Semester semester;              // where course is planned
+    Semester prerequisiteSemester;  // invalid when not planned at all
+
+    QString message(const PrerequisiteGraph& graph) const;
+};
+
+// One profile's course_planning rows as semester positions over the graph's
+// course ids, read in a single query. For the plan's semesters s0 < s1 < ...
+// it keeps completedBefore_[k], the courses planned in s0..s(k-1), so
+// checking a course is one word-parallel subset test of its prerequisite
+// mask against the prefix that ends before its semester, and one of its
+// corequisite mask against the prefix that includes it.
+class CoursePlan
+{
+public:
+    explicit CoursePlan(const PrerequisiteGraph& graph);
+
+    bool load(int profileId);
+
+    // Moves course to semester, or removes it, for checking an edit before
+    // it is written or following one after. Only the prefixes after the
+    // course's semester change, so the cost is bounded by the number of
+    // semesters, not the number of planned courses.
+    void place(int course, const Semester& semester);
+    void remove(int course);
+
+    Semester semesterOf(int course) const;
+    const CourseSet& planned() const { return completedBefore_.last(); }
+    Semester latestSemester() const;
+
+    // Courses marked done; for projections, which only count what is behind
+    // the student
+    const CourseSet& completed() const { return completed_; }
+    void setCompleted(int course, bool done);
+
+    // What planning course in semester would violate
+    QList<PlanViolation> check(int course, const Semester& semester) const;
+    // Every violation in the plan, course by course in id order, from the
+    // same prefixes; for re-checking after an import, edit or delete
+    QList<PlanViolation> validate() const;
+    // Planned courses whose check can change when course is placed or
+    // removed: its direct dependents, since a check only looks at a
+    // course's own prerequisites
+    QList<int> affectedBy(int course) const;
+
+private:
+    const PrerequisiteGraph& graph_;
+    QVector<int> ordinalOf_;    // per course id, -1 when not planned
+    QVector<int> ordinals_;     // distinct, ascending
+    QVector<int> semesterSizes_;
+    QVector<CourseSet> completedBefore_;
+    CourseSet completed_;
+
+    void rebuild();
+    // Index into completedBefore_ of the prefix ending before semester
+    int prefixBefore(const Semester& semester) const;
+};
+
+#endif // COURSEPLAN_H
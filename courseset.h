@@ -0,0 +1,71 @@
+#ifndef COURSESET_H
+#define COURSESET_H
+
+#include <QVector>
+#include <QtAlgorithms>
+
+// A set of PrerequisiteGraph course ids packed 64 to a word, so unions,
+// subset tests and counts over a whole catalog run one word at a time.
+// Sets combined with each other must have the same size.
+class CourseSet
+{
+public:
+    CourseSet() = default;
+    explicit CourseSet(int size) : words_((size + 63) / 64, 0), size_(size) {}
+
+    int size() const { return size_; }
+
+    bool contains(int course) const {
+        return (words_.at(course >> 6) >> (course & 63)) & 1;
+    }
+    void insert(int course) { words_[course >> 6] |= quint64(1) << (course & 63); }
+    void remove(int course) { words_[course >> 6] &= ~(quint64(1) << (course & 63)); }
+
+    CourseSet& operator|=(const CourseSet& other) {
+        quint64* words = words_.data();
+        const quint64* others = other.words_.constData();
+        for (qsizetype i = 0, n = words_.size(); i < n; ++i) {
+            words[i] |= others[i];
+        }
+        return *this;
+    }
+
+    // Every member is also in other
+    bool isSubsetOf(const CourseSet& other) const {
+        const quint64* words = words_.constData();
+        const quint64* others = other.words_.constData();
+        for (qsizetype i = 0, n = words_.size(); i < n; ++i) {
+            if (words[i] & ~others[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool operator==(const CourseSet& other) const { return words_ == other.words_; }
+    bool operator!=(const CourseSet& other) const { return words_ != other.words_; }
+
+    int count() const {
+        int total = 0;
+        for (quint64 word : words_) {
+            total += qPopulationCount(word);
+        }
+        return total;
+    }
+
+    // Calls f(course) for each member in increasing order
+    template <typename F>
+    void forEach(F f) const {
+        for (qsizetype i = 0, n = words_.size(); i < n; ++i) {
+            for (quint64 word = words_.at(i); word; word &= word - 1) {
+                f(int(i * 64 + qCountTrailingZeroBits(word)));
+            }
+        }
+    }
+
+private:
+    QVector<quint64> words_;
+    int size_ = 0;
+};
+
+#endif // COURSESET_H
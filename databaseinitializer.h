@@ -1,24 +1,39 @@
 #ifndef DATABASEINITIALIZER_H
 #define DATABASEINITIALIZER_H
 
+#include "connectionprofile.h"
+
 #include <QSqlDatabase>
 #include <QString>
 
 class DatabaseInitializer
 {
 public:
-    static bool initializeDatabase(const QString& dbPath);
+    static bool initializeDatabase(const QString& dbPath,
+                                   const ConnectionProfile& profile = ConnectionProfile::interactive());
+    // Creates or upgrades a standalone catalog database, as used by the importer
+    static bool initializeCatalog(QSqlDatabase& db);
+    // Runs EXPLAIN QUERY PLAN over PlanQueries, false on a query that no longer
+    // prepares or on a full table scan outside PlanQueries::fullReads
+    static bool checkQueryPlans(QSqlDatabase& db);
 
 private:
-    static bool createTables(QSqlDatabase& db);
+    static bool migrate(QSqlDatabase& db, bool catalogTables, bool userTables);
+    static bool initializeWithCatalog(QSqlDatabase& db);
+    static bool installCatalogImage(const QString& catalogPath, bool* replaced);
+    // Builds Catalog.db from the compiled-in tables, or migrates the one
+    // an earlier launch built
+    static bool seedCatalog(const QString& catalogPath);
+    static bool seedCatalogTables(QSqlDatabase& db);
+    static bool refreshCourseKeys(QSqlDatabase& db);
+    static bool createUserTables(QSqlDatabase& db);
+    static bool createCatalogTables(QSqlDatabase& db);
     static bool insertAllData(QSqlDatabase& db);
     static bool insertSchools(QSqlDatabase& db);
     static bool insertDepartments(QSqlDatabase& db);
     static bool insertCourses(QSqlDatabase& db);
-    static bool insertSemesters(QSqlDatabase& db);
     static bool insertMajors(QSqlDatabase& db);
     static bool insertPrerequisites(QSqlDatabase& db);
-    static bool createTrigger(QSqlDatabase& db);
 };
 
 struct Course {
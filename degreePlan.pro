@@ -1,4 +1,4 @@
-QT       += core gui sql
+QT       += core gui sql concurrent
 
 greaterThan(QT_MAJOR_VERSION, 4): QT += widgets
 
@@ -11,21 +11,55 @@ CONFIG += c++17
 RC_ICONS = icons/app-icon.ico# For Windows
 
 SOURCES += \
+    catalogimporter.cpp \
+    connectionprofile.cpp \
+    coursecard.cpp \
+    coursecarddelegate.cpp \
     coursedetails.cpp \
+    coursegraphitem.cpp \
+    courseplan.cpp \
+    databaseinitializer.cpp \
+    degreeplanner.cpp \
+    degreerequirements.cpp \
     editcoursedetails.cpp \
     global_objects.cpp \
+    graduationprojection.cpp \
+    institutioncatalog.cpp \
     main.cpp \
     mainwindow.cpp \
     newsemester.cpp \
+    planboard.cpp \
+    planmodel.cpp \
+    plansnapshot.cpp \
+    prerequisitegraph.cpp \
+    semester.cpp \
     welcomewindow.cpp
 
 HEADERS += \
-    course.h \
+    catalogimporter.h \
+    catalogrecords.h \
+    connectionprofile.h \
+    coursecard.h \
+    coursecarddelegate.h \
     coursedetails.h \
+    coursegraphitem.h \
+    courseplan.h \
+    courseset.h \
+    databaseinitializer.h \
+    degreeplanner.h \
+    degreerequirements.h \
     editcoursedetails.h \
     global_objects.h \
+    graduationprojection.h \
+    institutioncatalog.h \
     mainwindow.h \
     newsemester.h \
+    planboard.h \
+    planmodel.h \
+    planqueries.h \
+    plansnapshot.h \
+    prerequisitegraph.h \
+    semester.h \
     welcomewindow.h
 
 FORMS += \
@@ -47,3 +81,31 @@ else: unix:!android: target.path = /opt/$${TARGET}/bin
 
 RESOURCES += \
     resources.qrc
+
+# Compiled-in catalog used to seed databases when no image is bundled
+include(catalog/catalogdata.pri)
+
+# Prebuilt, read-only catalog image (qmake CONFIG+=catalog_image).
+# catalog/build.sql is replayed through the sqlite3 shell at build time and the
+# result is bundled as :/catalog/catalog.db; without it the catalog is seeded
+# from DatabaseInitializer on first launch instead.
+catalog_image {
+    CATALOG_DB = $$PWD/catalog/catalog.db
+
+    catalog_db.target = $$CATALOG_DB
+    catalog_db.depends = \
+        $$PWD/catalog/build.sql \
+        $$PWD/catalog/schema.sql \
+        $$files($$PWD/catalog/*.csv)
+    catalog_db.commands = \
+        $(DEL_FILE) $$shell_path($$CATALOG_DB) $$escape_expand(\\n\\t) \
+        cd $$shell_path($$PWD/catalog) && sqlite3 catalog.db < build.sql
+
+    # rcc must not run before the image exists
+    catalog_qrc.target = qrc_catalog.cpp
+    catalog_qrc.depends = $$CATALOG_DB
+
+    QMAKE_EXTRA_TARGETS += catalog_db catalog_qrc
+    QMAKE_CLEAN += $$CATALOG_DB
+    RESOURCES += catalog/catalog.qrc
+}
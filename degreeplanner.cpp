@@ -0,0 +1,245 @@
+#include "degreeplanner.h"
+#include <QDebug>
+#include <QElapsedTimer>
+#include <QMutexLocker>
+#include <QThread>
+#include <QtConcurrent>
+#include <algorithm>
+
+DegreePlanner::DegreePlanner(const DegreeRequirements& requirements)
+    : requirements_(requirements)
+    , graph_(requirements.graph())
+    , taken_(requirements.graph().courseCount())
+{
+}
+
+void DegreePlanner::load(const CoursePlan& plan) {
+    taken_ = plan.planned();
+    Semester latest = plan.latestSemester();
+    settings_.first = latest.isValid() ? Semester::fromOrdinal(latest.ordinal() + 1)
+                                       : requirements_.start();
+    settings_.last = requirements_.graduation();
+
+    // Required courses by the longest chain of required courses still to
+    // follow them, then electives that can be taken soonest. The sort is
+    // stable over the topological order, so a corequisite is offered before
+    // its course.
+    const CourseSet& required = requirements_.required();
+    QVector<int> tail(graph_.courseCount(), 0);
+    const QVector<int>& order = graph_.order();
+    for (int i = int(order.size()) - 1; i >= 0; --i) {
+        int course = order[i];
+        for (int dependent : graph_.dependents(course)) {
+            if (required.contains(dependent)) {
+                int step = graph_.isCorequisite(dependent, course) ? 0 : 1;
+                tail[course] = qMax(tail[course], tail[dependent] + step);
+            }
+        }
+    }
+    priority_.clear();
+    for (int course : order) {
+        if (!taken_.contains(course)) {
+            priority_.append(course);
+        }
+    }
+    std::stable_sort(priority_.begin(), priority_.end(), [&](int a, int b) {
+        bool requiredA = required.contains(a);
+        bool requiredB = required.contains(b);
+        if (requiredA != requiredB) {
+            return requiredA;
+        }
+        if (requiredA) {
+            return tail[a] > tail[b];
+        }
+        if (graph_.minimumSemesters(a) != graph_.minimumSemesters(b)) {
+            return graph_.minimumSemesters(a) < graph_.minimumSemesters(b);
+        }
+        return requirements_.credits(a) > requirements_.credits(b);
+    });
+}
+
+bool DegreePlanner::isComplete(const State& state) const {
+    return state.credits >= requirements_.creditsRequired()
+        && requirements_.required().isSubsetOf(state.taken);
+}
+
+// Neither bound counts electives' prerequisites, so it never overshoots
+int DegreePlanner::lowerBound(const State& state) const {
+    int credits = qMax(requirements_.creditsRequired() - state.credits, state.requiredCredits);
+    int bound = (credits + settings_.creditCap - 1) / settings_.creditCap;
+    return qMax(bound, requirements_.depthLeft(state.taken));
+}
+
+// Greedy fillings of the next semester in priority order: the first takes
+// every course that fits, the k-th leaves out the k-th required course that
+// would have, to make room for the rest
+QList<QVector<int>> DegreePlanner::fillings(const State& state) const {
+    QList<QVector<int>> result;
+    for (int variant = 0; variant < settings_.branching; ++variant) {
+        QVector<int> picks;
+        CourseSet through = state.taken;
+        int credits = 0;
+        int electiveCredits = requirements_.creditsRequired() - state.credits - state.requiredCredits;
+        int requiredSeen = 0;
+        for (int course : priority_) {
+            if (through.contains(course)) {
+                continue;
+            }
+            bool required = requirements_.required().contains(course);
+            if ((!required && electiveCredits <= 0)
+                || credits + requirements_.credits(course) > settings_.creditCap
+                || !graph_.prerequisiteMask(course).isSubsetOf(state.taken)
+                || !graph_.corequisiteMask(course).isSubsetOf(through)) {
+                continue;
+            }
+            if (required && requiredSeen++ == variant - 1) {
+                continue;
+            }
+            picks.append(course);
+            through.insert(course);
+            credits += requirements_.credits(course);
+            if (!required) {
+                electiveCredits -= requirements_.credits(course);
+            }
+        }
+        if (!picks.isEmpty() && !result.contains(picks)) {
+            result.append(picks);
+        }
+    }
+    return result;
+}
+
+void DegreePlanner::apply(State& state, const QVector<int>& picks) const {
+    for (int course : picks) {
+        state.taken.insert(course);
+        state.credits += requirements_.credits(course);
+        if (requirements_.required().contains(course)) {
+            state.requiredCredits -= requirements_.credits(course);
+        }
+    }
+    state.semesters.append(picks);
+}
+
+void DegreePlanner::undo(State& state) const {
+    for (int course : state.semesters.last()) {
+        state.taken.remove(course);
+        state.credits -= requirements_.credits(course);
+        if (requirements_.required().contains(course)) {
+            state.requiredCredits += requirements_.credits(course);
+        }
+    }
+    state.semesters.removeLast();
+}
+
+void DegreePlanner::search(State& state) {
+    if (cancelled_ || nodes_.fetch_add(1) >= settings_.nodeBudget) {
+        return;
+    }
+    int used = int(state.semesters.size());
+    if (isComplete(state)) {
+        record(state);
+        return;
+    }
+    if (used >= terms_.size() || used + lowerBound(state) >= best_) {
+        return;
+    }
+    for (const QVector<int>& picks : fillings(state)) {
+        apply(state, picks);
+        search(state);
+        undo(state);
+        // Every other child needs at least one more semester too
+        if (used + 1 >= best_) {
+            return;
+        }
+    }
+}
+
+void DegreePlanner::record(const State& state) {
+    QMutexLocker locker(&mutex_);
+    if (state.semesters.size() < best_) {
+        best_ = int(state.semesters.size());
+        bestPicks_ = state.semesters;
+    }
+}
+
+bool DegreePlanner::run() {
+    QElapsedTimer timer;
+    timer.start();
+
+    error_.clear();
+    result_.clear();
+    bestPicks_.clear();
+    nodes_ = 0;
+
+    terms_.clear();
+    for (int ordinal = settings_.first.ordinal(); ordinal <= settings_.last.ordinal(); ++ordinal) {
+        Semester term = Semester::fromOrdinal(ordinal);
+        if (settings_.summers || term.term() != Semester::Summer) {
+            terms_.append(term);
+        }
+    }
+    best_ = int(terms_.size()) + 1;
+
+    State root{taken_, requirements_.creditsOf(taken_), requirements_.requiredCreditsLeft(taken_), {}};
+    if (isComplete(root)) {
+        error_ = "The plan already covers the major's requirements";
+        return false;
+    }
+    for (int course : priority_) {
+        if (requirements_.required().contains(course) && requirements_.credits(course) > settings_.creditCap) {
+            error_ = QString("%1 has more credits than a semester allows")
+                         .arg(graph_.courseCode(course));
+            return false;
+        }
+    }
+
+    // A greedy dive first, so every subtree starts with a bound
+    State dive = root;
+    while (!isComplete(dive) && dive.semesters.size() < terms_.size()) {
+        QList<QVector<int>> next = fillings(dive);
+        if (next.isEmpty()) {
+            break;
+        }
+        apply(dive, next.first());
+    }
+    if (isComplete(dive)) {
+        record(dive);
+    }
+
+    // Enough subtrees for every thread to keep taking more as it finishes
+    QVector<State> frontier{root};
+    for (int level = 0; level < 3 && frontier.size() < QThread::idealThreadCount() * 4; ++level) {
+        QVector<State> next;
+        for (State& state : frontier) {
+            QList<QVector<int>> children;
+            if (!isComplete(state) && state.semesters.size() < terms_.size()) {
+                children = fillings(state);
+            }
+            if (children.isEmpty()) {
+                next.append(state);
+            }
+            for (const QVector<int>& picks : children) {
+                State child = state;
+                apply(child, picks);
+                next.append(child);
+            }
+        }
+        frontier.swap(next);
+    }
+    QtConcurrent::blockingMap(frontier, [this](State& state) { search(state); });
+
+    qDebug() << "Planner searched" << qMin(int(nodes_), settings_.nodeBudget) << "nodes in"
+             << frontier.size() << "subtrees in" << timer.elapsed() << "ms";
+
+    if (bestPicks_.isEmpty()) {
+        error_ = cancelled_ ? QString("Planning was cancelled")
+                            : "No plan fits the remaining courses before " + settings_.last.title();
+        return false;
+    }
+    for (int i = 0; i < bestPicks_.size(); ++i) {
+        for (int course : bestPicks_[i]) {
+            result_.append({course, terms_[i]});
+        }
+    }
+    return true;
+}
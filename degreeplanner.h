@@ -0,0 +1,93 @@
+#ifndef DEGREEPLANNER_H
+#define DEGREEPLANNER_H
+
+#include "courseplan.h"
+#include "courseset.h"
+#include "degreerequirements.h"
+#include "semester.h"
+
+#include <QList>
+#include <QMutex>
+#include <QString>
+#include <QVector>
+#include <atomic>
+
+// A course the planner placed
+struct PlannedCourse {
+    int course;
+    Semester semester;
+};
+
+// Fills the semesters after a profile's plan with the courses its major
+// still requires, and electives up to the major's credit requirement, in as
+// few semesters as prerequisites and the per-semester credit cap allow.
+//
+// The search is a depth-first branch and bound with one semester per
+// level. Each level tries a few fillings of the semester, longest remaining
+// required chain first, and a branch is cut once its semesters plus a lower
+// bound (credits left over the cap, longest chain of required courses left)
+// can't beat the best plan found so far. The first levels are expanded up
+// front and their subtrees searched on QtConcurrent's thread pool, all
+// sharing that bound.
+class DegreePlanner
+{
+public:
+    struct Settings {
+        Semester first;             // first semester to fill
+        Semester last;              // the plan has to end by this one
+        int creditCap = 18;
+        bool summers = false;
+        int branching = 4;          // fillings tried per semester
+        int nodeBudget = 200000;    // over all threads; the best plan found is kept
+    };
+
+    explicit DegreePlanner(const DegreeRequirements& requirements);
+
+    // Courses in plan count as taken, and the settings start right after
+    // the last of them and end at graduation
+    void load(const CoursePlan& plan);
+
+    Settings& settings() { return settings_; }
+
+    // Blocks until the search is over, the node budget is spent or cancel()
+    // is called from another thread
+    bool run();
+    void cancel() { cancelled_ = true; }
+
+    QList<PlannedCourse> result() const { return result_; }
+    int semesterCount() const { return int(bestPicks_.size()); }
+    QString errorString() const { return error_; }
+
+private:
+    struct State {
+        CourseSet taken;
+        int credits;
+        int requiredCredits;                // of required courses not taken
+        QVector<QVector<int>> semesters;    // courses picked per term
+    };
+
+    const DegreeRequirements& requirements_;
+    const PrerequisiteGraph& graph_;
+    Settings settings_;
+    CourseSet taken_;
+    QVector<int> priority_;         // untaken courses, most urgent first
+    QVector<Semester> terms_;
+
+    std::atomic<bool> cancelled_{false};
+    std::atomic<int> best_{0};      // semesters of the best plan found
+    std::atomic<int> nodes_{0};
+    QMutex mutex_;
+    QVector<QVector<int>> bestPicks_;
+    QList<PlannedCourse> result_;
+    QString error_;
+
+    bool isComplete(const State& state) const;
+    int lowerBound(const State& state) const;
+    QList<QVector<int>> fillings(const State& state) const;
+    void apply(State& state, const QVector<int>& picks) const;
+    void undo(State& state) const;
+    void search(State& state);
+    void record(const State& state);
+};
+
+#endif // DEGREEPLANNER_H
@@ -0,0 +1,96 @@
+#include "degreerequirements.h"
+#include "planqueries.h"
+#include <QSqlQuery>
+#include <QSqlError>
+#include <QDebug>
+
+DegreeRequirements::DegreeRequirements(const PrerequisiteGraph& graph)
+    : graph_(graph)
+    , credits_(graph.courseCount(), 0)
+    , required_(graph.courseCount())
+{
+}
+
+bool DegreeRequirements::load(int profileId) {
+    QSqlQuery query;
+    query.setForwardOnly(true);
+    query.prepare(PlanQueries::profileRequirements);
+    query.bindValue(":profile_id", profileId);
+    if (!query.exec() || !query.next()) {
+        error_ = "Failed to read profile: " + query.lastError().text();
+        qDebug() << error_;
+        return false;
+    }
+    Semester::Term startingTerm = Semester::Fall;
+    Semester::parseTerm(query.value(0).toString(), startingTerm);
+    start_ = Semester(query.value(1).toInt(), startingTerm);
+    graduation_ = Semester(query.value(2).toInt(), Semester::Spring);
+    creditsRequired_ = query.value(3).toInt();
+    QString department = query.value(4).toString();
+
+    if (!query.exec(PlanQueries::requirementCourses)) {
+        error_ = "Failed to read courses: " + query.lastError().text();
+        qDebug() << error_;
+        return false;
+    }
+    CourseSet required(graph_.courseCount());
+    while (query.next()) {
+        int course = graph_.courseId(query.value(0).toString());
+        if (course < 0) {
+            continue;
+        }
+        credits_[course] = query.value(1).toInt();
+        QString type = query.value(3).toString();
+        if (query.value(2).toString() == department && (type == "Core" || type == "Required")) {
+            required.insert(course);
+        }
+    }
+    required_ = required;
+    required.forEach([this](int course) { required_ |= graph_.allPrerequisites(course); });
+
+    requiredOrder_.clear();
+    for (int course : graph_.order()) {
+        if (required_.contains(course)) {
+            requiredOrder_.append(course);
+        }
+    }
+    return true;
+}
+
+int DegreeRequirements::creditsOf(const CourseSet& courses) const {
+    int total = 0;
+    courses.forEach([&](int course) { total += credits_[course]; });
+    return total;
+}
+
+int DegreeRequirements::requiredCreditsLeft(const CourseSet& taken) const {
+    int total = 0;
+    for (int course : requiredOrder_) {
+        if (!taken.contains(course)) {
+            total += credits_[course];
+        }
+    }
+    return total;
+}
+
+// Prerequisites of a required course are required, so they come first in
+// requiredOrder_ and already have their depth
+int DegreeRequirements::depthLeft(const CourseSet& taken) const {
+    thread_local QVector<int> depth;
+    depth.resize(graph_.courseCount());
+    int deepest = 0;
+    for (int course : requiredOrder_) {
+        if (taken.contains(course)) {
+            continue;
+        }
+        int d = 1;
+        for (int prereq : graph_.prerequisites(course)) {
+            if (!taken.contains(prereq)) {
+                d = qMax(d, depth[prereq] + (graph_.isCorequisite(course, prereq) ? 0 : 1));
+            }
+        }
+        depth[course] = d;
+        deepest = qMax(deepest, d);
+    }
+    return deepest;
+}
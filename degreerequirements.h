@@ -0,0 +1,52 @@
+#ifndef DEGREEREQUIREMENTS_H
+#define DEGREEREQUIREMENTS_H
+
+#include "courseset.h"
+#include "prerequisitegraph.h"
+#include "semester.h"
+
+#include <QString>
+#include <QVector>
+
+// What a profile's major asks for, read once over the active catalog: the
+// credits of every course, the major's core and required courses closed
+// over their prerequisites, the credit requirement, and the profile's first
+// and graduation terms. DegreePlanner searches against it and
+// GraduationProjection bounds against it.
+class DegreeRequirements
+{
+public:
+    explicit DegreeRequirements(const PrerequisiteGraph& graph);
+
+    bool load(int profileId);
+    QString errorString() const { return error_; }
+
+    const PrerequisiteGraph& graph() const { return graph_; }
+    int credits(int course) const { return credits_.at(course); }
+    int creditsOf(const CourseSet& courses) const;
+    int creditsRequired() const { return creditsRequired_; }
+    const CourseSet& required() const { return required_; }
+    // Required courses, prerequisites first
+    const QVector<int>& requiredOrder() const { return requiredOrder_; }
+    // Credits of the required courses outside taken
+    int requiredCreditsLeft(const CourseSet& taken) const;
+    // Semesters the longest chain of required courses outside taken still
+    // needs, corequisites sharing one
+    int depthLeft(const CourseSet& taken) const;
+
+    Semester start() const { return start_; }
+    // Graduation is in the spring, as MainWindow has always assumed
+    Semester graduation() const { return graduation_; }
+
+private:
+    const PrerequisiteGraph& graph_;
+    QVector<int> credits_;
+    CourseSet required_;
+    QVector<int> requiredOrder_;
+    int creditsRequired_ = 0;
+    Semester start_;
+    Semester graduation_;
+    QString error_;
+};
+
+#endif // DEGREEREQUIREMENTS_H
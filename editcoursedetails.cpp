@@ -1,4 +1,8 @@
 #include "editcoursedetails.h"
+#include "courseplan.h"
+#include "global_objects.h"
+#include "planqueries.h"
+#include "prerequisitegraph.h"
 #include "qabstractitemview.h"
 #include "qcompleter.h"
 #include "qmessagebox.h"
@@ -7,10 +11,12 @@
 #include "ui_editcoursedetails.h"
 
 #include <QMouseEvent>
+#include <algorithm>
 
-EditCourseDetails::EditCourseDetails(QString course_code ,QString semester, QWidget *parent)
+EditCourseDetails::EditCourseDetails(QString course_code ,QString semester, const CoursePlan &plan, QWidget *parent)
     : QDialog(parent)
     , ui(new Ui::EditCourseDetails)
+    , plan(plan)
 {
     ui->setupUi(this);
 
@@ -80,8 +86,7 @@ EditCourseDetails::EditCourseDetails(QString course_code ,QString semester, QWid
     //ui->comboBox->lineEdit()->installEventFilter(this);
 
     QSqlQuery query;
-    query.prepare("Select is_current_course, is_planned_course, is_done_course, grade from course_planning "
-                  "where course_code = :course");
+    query.prepare(PlanQueries::courseStatus);
     query.bindValue(":course", course_code);
     query.exec();
     query.next();
@@ -101,9 +106,8 @@ EditCourseDetails::~EditCourseDetails()
 
 void EditCourseDetails::populateCoursesCombobox(){
     QSqlQuery query;
-    query.prepare("Select course_code from course "
-               "where course_code NOT IN (select cp.course_code from course_planning cp where cp.course_code != :course_code)");
-    query.bindValue(":couse_code", old_course_code);
+    query.prepare(PlanQueries::replacementCourses);
+    query.bindValue(":course_code", old_course_code);
     query.exec();
     while(query.next()){
         QString course = query.value(0).toString();
@@ -117,7 +121,7 @@ void EditCourseDetails::on_comboBox_currentIndexChanged(int index)
     this->new_course_code = course;
 
     QSqlQuery query;
-    query.prepare("Select course_title, course_credits from course where course_code = :course");
+    query.prepare(PlanQueries::courseSummary);
     query.bindValue(":course", course);
     query.exec();
     query.next();
@@ -134,51 +138,101 @@ void EditCourseDetails::on_comboBox_currentIndexChanged(int index)
 
 void EditCourseDetails::on_buttonBox_accepted()
 {
+    // The course being replaced can't satisfy its own replacement
+    const PrerequisiteGraph &graph = PrerequisiteGraph::active();
+    int old_course = graph.courseId(old_course_code);
+    int new_course = graph.courseId(new_course_code);
+    // The replacement keeps the row, and so the semester, of the old course
+    Semester planned = plan.semesterOf(old_course);
+    if(!planned.isValid()){
+        planned = Semester::fromCode(semester);
+    }
+    CoursePlan edited(plan);
+    edited.remove(old_course);
+    edited.place(new_course, planned);
+    // Only what the edit introduces: a grade or status change keeps the
+    // course, and a replacement may miss what the old course already missed
+    QStringList errors;
+    if(new_course != old_course){
+        QList<PlanViolation> before = plan.check(old_course, planned);
+        for(const PlanViolation &violation : edited.check(new_course, planned)){
+            bool existing = std::any_of(before.cbegin(), before.cend(), [&](const PlanViolation &old){
+                return old.prerequisite == violation.prerequisite
+                       && old.corequisite == violation.corequisite;
+            });
+            if(!existing){
+                errors.append(violation.message(graph));
+            }
+        }
+    }
+    QStringList broken;
+    for(int dependent : edited.affectedBy(old_course)){
+        for(const PlanViolation &violation : edited.check(dependent, edited.semesterOf(dependent))){
+            if(violation.prerequisite == old_course){
+                broken.append(violation.message(graph));
+            }
+        }
+    }
+    if(!errors.isEmpty()){
+        showError("You dont have the required prerequisites:\n" + errors.join("\n"));
+        reject();
+        return;
+    }
+    if(!broken.isEmpty() &&
+        QMessageBox::question(this, "Replace course",
+                              old_course_code + " is required by other planned courses:\n"
+                                  + broken.join("\n") + "\n\nReplace it anyway?") != QMessageBox::Yes){
+        reject();
+        return;
+    }
+
     QSqlQuery query;
-    query.prepare("Update course_planning set course_code = ?, is_current_course = ?,"
-                  "is_done_course = ?, is_planned_course = ?, grade = ? "
-                  "where course_code = ?");
-    query.addBindValue(new_course_code);
-    query.addBindValue(is_current_course);
-    query.addBindValue(is_done_course);
-    query.addBindValue(is_planned_course);
-    query.addBindValue(grade);
-    query.addBindValue(old_course_code);
+    query.prepare(PlanQueries::updatePlannedCourse);
+    query.bindValue(":new_course_code", new_course_code);
+    query.bindValue(":is_current_course", is_current_course);
+    query.bindValue(":is_done_course", is_done_course);
+    query.bindValue(":is_planned_course", is_planned_course);
+    query.bindValue(":grade", grade);
+    query.bindValue(":old_course_code", old_course_code);
     query.exec();
 
     if(query.lastError().isValid()){
-        QMessageBox msgBox;
-        msgBox.setWindowTitle("Error");
-        msgBox.setText(query.lastError().text());
-        msgBox.setIcon(QMessageBox::Critical);
-
-        // Apply style sheet
-        msgBox.setStyleSheet(
-            "QMessageBox { "
-            "   background-color: #2b2b2b; "
-            "   color: white; "
-            "}"
-            "QMessageBox QLabel { "
-            "   color: white; "
-            "   font-size: 14px; "
-            "}"
-            "QMessageBox QPushButton { "
-            "   background-color: #0078d4; "
-            "   color: white; "
-            "   border: none; "
-            "   padding: 8px 16px; "
-            "   border-radius: 4px; "
-            "   min-width: 80px; "
-            "}"
-            "QMessageBox QPushButton:hover { "
-            "   background-color: #106ebe; "
-            "}"
-            );
-
-        msgBox.exec();
-
+        showError(query.lastError().text());
         reject();
-    }
+    } else ++plan_revision;
+}
+
+void EditCourseDetails::showError(const QString &message)
+{
+    QMessageBox msgBox;
+    msgBox.setWindowTitle("Error");
+    msgBox.setText(message);
+    msgBox.setIcon(QMessageBox::Critical);
+
+    // Apply style sheet
+    msgBox.setStyleSheet(
+        "QMessageBox { "
+        "   background-color: #2b2b2b; "
+        "   color: white; "
+        "}"
+        "QMessageBox QLabel { "
+        "   color: white; "
+        "   font-size: 14px; "
+        "}"
+        "QMessageBox QPushButton { "
+        "   background-color: #0078d4; "
+        "   color: white; "
+        "   border: none; "
+        "   padding: 8px 16px; "
+        "   border-radius: 4px; "
+        "   min-width: 80px; "
+        "}"
+        "QMessageBox QPushButton:hover { "
+        "   background-color: #106ebe; "
+        "}"
+        );
+
+    msgBox.exec();
 }
 
 
@@ -211,82 +265,12 @@ void EditCourseDetails::on_checkBox_2_checkStateChanged(const Qt::CheckState &ar
     }
 }
 
-course EditCourseDetails::getUpdatedCourse(){
-    course new_course;
-    new_course.titleLabel = new QLabel();
-    new_course.titleLabel->setText(new_course_code);
-
-    new_course.statusLabel = new QLabel();
-    auto [status, style_sheet] = getCourseStatus(is_done_course, is_current_course, is_planned_course);
-    new_course.statusLabel->setText(status);
-    new_course.statusLabel->setStyleSheet(style_sheet);
-    new_course.statusLabel->setMinimumHeight(33);
-
-    QSqlQuery query;
-
-    query.prepare("Select course_title from course where course_code = :course_code");
-    query.bindValue(":course_code", new_course_code);
-    query.exec();
-    QString description;
-    if(query.next()){
-        description = query.value(0).toString();
-    }
-    new_course.desc = new QLabel();
-    new_course.desc->setText(description);
-    new_course.desc->setAlignment(Qt::AlignLeft);
-
-    query.prepare("Select course_credits from course where course_code = :course_code");
-    query.bindValue(":course_code", new_course_code);
-    query.exec();
-    QString credits_number;
-    if(query.next()){
-        credits_number = query.value(0).toString();
-    }
-    new_course.credits = new QLabel();
-    new_course.credits->setText(credits_number + " credits");
-
-    query.prepare("Select course_level from course where course_code = :course_code");
-    query.bindValue(":course_code", new_course_code);
-    query.exec();
-    QString course_level;
-    if(query.next()){
-        course_level = query.value(0).toString();
-    }
-    new_course.level = new QLabel();
-    new_course.level->setText(course_level);
-
-    new_course.grade = new QLabel();
-    new_course.grade->setText("Grade: " + grade);
-
-    return new_course;
+bool EditCourseDetails::getCourseDone(){
+    return is_done_course;
 }
 
-std::tuple<QString, QString> EditCourseDetails::getCourseStatus(bool is_done, bool is_current, bool is_planned){
-    QString style_sheet;
-
-    if (is_done){
-        style_sheet = "QLabel { background-color: #4CAF50; "
-                      "color: white; border-radius: 8px; padding: 6px 12px; "
-                      "font-weight: bold; font-size: 14px; "
-                      "border: 1px solid #388E3C; "
-                      "qproperty-alignment: AlignCenter; }";
-        return {"Completed", style_sheet};
-    } else if (is_current){
-        style_sheet = "QLabel { background-color: #2196F3; "
-                      "color: white; border-radius: 8px; padding: 6px 12px; "
-                      "font-weight: bold; font-size: 14px; "
-                      "border: 1px solid #1976D2; "
-                      "qproperty-alignment: AlignCenter; }";
-        return {"Current", style_sheet};
-    } else if(is_planned){
-        style_sheet = "QLabel { background-color: #9C27B0; "
-                      "color: white; border-radius: 8px; padding: 6px 12px; "
-                      "font-weight: bold; font-size: 14px; "
-                      "border: 1px solid #7B1FA2; "
-                      "qproperty-alignment: AlignCenter; }";
-        return {"Planned", style_sheet};
-    }
-    else return {"Null", ""};
+QString EditCourseDetails::getCourseCode(){
+    return new_course_code;
 }
 
 void EditCourseDetails::checkCurrentCourse(QString course_code)
@@ -1,7 +1,8 @@
 #ifndef EDITCOURSEDETAILS_H
 #define EDITCOURSEDETAILS_H
 
-#include "course.h"
+#include "courseplan.h"
+
 #include <QDialog>
 
 namespace Ui {
@@ -13,10 +14,12 @@ class EditCourseDetails : public QDialog
     Q_OBJECT
 
 public:
-    explicit EditCourseDetails(QString course_code ,QString semester, QWidget *parent = nullptr);
+    // plan is MainWindow's; the swap is checked on a copy of it
+    EditCourseDetails(QString course_code ,QString semester, const CoursePlan &plan, QWidget *parent = nullptr);
     ~EditCourseDetails();
 
-    course getUpdatedCourse();
+    QString getCourseCode();
+    bool getCourseDone();
 
 private slots:
     void on_comboBox_currentIndexChanged(int index);
@@ -36,13 +39,14 @@ private:
     QString old_course_code;
     QString new_course_code;
     QString semester;
+    const CoursePlan &plan;
     int is_current_course = 0;
     int is_done_course = 0;
     int is_planned_course = 0;
     QString grade;
 
     void populateCoursesCombobox();
-    std::tuple<QString, QString> getCourseStatus(bool is_done, bool is_current, bool is_planned);
+    void showError(const QString &message);
     void checkCurrentCourse(QString course_code);
 
 protected:
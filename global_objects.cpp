@@ -1,3 +1,4 @@
 #include "global_objects.h"
 
 int profile_id = -1; // Initialize with default value
+int plan_revision = 0;
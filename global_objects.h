@@ -2,5 +2,8 @@
 #define GLOBAL_PROFILE_H
 
 extern int profile_id;
+// Bumped after every write to a profile or its plan, so a window can tell
+// whether what it shows is stale without asking the database
+extern int plan_revision;
 
 #endif // GLOBAL_PROFILE_H
@@ -0,0 +1,60 @@
+#include "graduationprojection.h"
+#include <QDebug>
+#include <QSettings>
+
+GraduationProjection::Settings GraduationProjection::Settings::load(const QString& configPath) {
+    Settings settings;
+    QSettings file(configPath, QSettings::IniFormat);
+    file.beginGroup("planning");
+    bool ok = false;
+    int creditCap = file.value("credit_cap", settings.creditCap).toInt(&ok);
+    if (ok && creditCap > 0) {
+        settings.creditCap = creditCap;
+    } else {
+        qDebug() << "Ignoring invalid credit_cap =" << file.value("credit_cap").toString();
+    }
+    settings.summers = file.value("summers", settings.summers).toBool();
+    file.endGroup();
+    return settings;
+}
+
+static Semester nextTerm(const Semester& term, bool summers) {
+    Semester next = Semester::fromOrdinal(term.ordinal() + 1);
+    if (!summers && next.term() == Semester::Summer) {
+        next = Semester::fromOrdinal(next.ordinal() + 1);
+    }
+    return next;
+}
+
+GraduationProjection::Result GraduationProjection::project(const DegreeRequirements& requirements,
+                                                           const CoursePlan& plan,
+                                                           const Settings& settings) {
+    Result result;
+    const CourseSet& done = plan.completed();
+
+    Semester latest;
+    done.forEach([&](int course) {
+        Semester semester = plan.semesterOf(course);
+        if (latest < semester) {
+            latest = semester;
+        }
+    });
+    result.first = latest.isValid() ? nextTerm(latest, settings.summers) : requirements.start();
+    if (!settings.summers && result.first.term() == Semester::Summer) {
+        result.first = nextTerm(result.first, false);
+    }
+
+    result.creditsLeft = qMax(0, requirements.creditsRequired() - requirements.creditsOf(done));
+    int credits = qMax(result.creditsLeft, requirements.requiredCreditsLeft(done));
+    result.terms = qMax((credits + settings.creditCap - 1) / settings.creditCap,
+                        requirements.depthLeft(done));
+    if (result.terms == 0) {
+        return result;
+    }
+
+    result.graduation = result.first;
+    for (int i = 1; i < result.terms; ++i) {
+        result.graduation = nextTerm(result.graduation, settings.summers);
+    }
+    return result;
+}
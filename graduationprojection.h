@@ -0,0 +1,41 @@
+#ifndef GRADUATIONPROJECTION_H
+#define GRADUATIONPROJECTION_H
+
+#include "courseplan.h"
+#include "degreerequirements.h"
+#include "semester.h"
+
+#include <QString>
+
+// The earliest term a profile can graduate in given what it has completed:
+// credits and required courses left over a per-term credit cap, and the
+// longest chain of required courses left, one term per link. Everything
+// comes from DegreeRequirements and a CoursePlan already in memory, so it is
+// cheap enough to recompute after every plan edit.
+class GraduationProjection
+{
+public:
+    // The [planning] group of DegreePlanner.ini:
+    //
+    //   [planning]
+    //   credit_cap=18
+    //   summers=false
+    struct Settings {
+        int creditCap = 18;
+        bool summers = false;
+
+        static Settings load(const QString& configPath);
+    };
+
+    struct Result {
+        Semester first;         // first term not behind the student
+        Semester graduation;    // invalid when nothing is left
+        int terms = 0;          // first to graduation, skipped summers excluded
+        int creditsLeft = 0;
+    };
+
+    static Result project(const DegreeRequirements& requirements, const CoursePlan& plan,
+                          const Settings& settings);
+};
+
+#endif // GRADUATIONPROJECTION_H
@@ -0,0 +1,141 @@
+#include "institutioncatalog.h"
+#include "prerequisitegraph.h"
+#include <QSqlQuery>
+#include <QSqlError>
+#include <QDebug>
+#include <QDir>
+#include <QFileInfo>
+#include <QUrl>
+
+const QString InstitutionCatalog::defaultCode = QStringLiteral("AUI");
+
+static QDir dataDirectory(const QSqlDatabase& db) {
+    return QFileInfo(db.databaseName()).absoluteDir();
+}
+
+static bool hasLocalCatalog(const QSqlDatabase& db) {
+    QSqlQuery query(db);
+    query.exec("SELECT 1 FROM main.sqlite_master WHERE type = 'table' AND name = 'course'");
+    return query.next();
+}
+
+// File currently attached as "catalog", empty when there is none
+static QString attachedCatalog(QSqlDatabase& db) {
+    QSqlQuery query(db);
+    query.exec("PRAGMA database_list");
+    while (query.next()) {
+        if (query.value("name").toString() == "catalog") {
+            return query.value("file").toString();
+        }
+    }
+    return QString();
+}
+
+// Reads the name from the institution table through a short-lived read-only
+// connection; catalogs imported without --institution-name have none
+static QString readName(const QString& path, const QString& code) {
+    QString name = code;
+    QString connection = "institution_" + code;
+    {
+        QSqlDatabase db = QSqlDatabase::addDatabase("QSQLITE", connection);
+        db.setDatabaseName(path);
+        db.setConnectOptions("QSQLITE_OPEN_READONLY");
+        if (db.open()) {
+            QSqlQuery query(db);
+            query.prepare("SELECT institution_name FROM institution WHERE institution_code = ?");
+            query.addBindValue(code);
+            if (query.exec() && query.next()) {
+                name = query.value(0).toString();
+            }
+        }
+    }
+    QSqlDatabase::removeDatabase(connection);
+    return name;
+}
+
+QString InstitutionCatalog::catalogPath(const QSqlDatabase& db, const QString& code) {
+    QDir dir = dataDirectory(db);
+    if (code == defaultCode) {
+        return dir.filePath("Catalog.db");
+    }
+    return dir.filePath("catalogs/" + code + ".db");
+}
+
+QList<Institution> InstitutionCatalog::available(const QSqlDatabase& db) {
+    QList<Institution> institutions;
+
+    // activate() can't switch away from a catalog kept in the user database
+    if (hasLocalCatalog(db)) {
+        institutions.append({defaultCode, defaultCode, db.databaseName()});
+        return institutions;
+    }
+
+    QString bundled = catalogPath(db, defaultCode);
+    if (QFileInfo::exists(bundled)) {
+        institutions.append({defaultCode, readName(bundled, defaultCode), bundled});
+    } else {
+        // Catalog kept in the user database itself
+        institutions.append({defaultCode, defaultCode, db.databaseName()});
+    }
+
+    QDir catalogs(dataDirectory(db).filePath("catalogs"));
+    const QFileInfoList files = catalogs.entryInfoList(QStringList() << "*.db", QDir::Files, QDir::Name);
+    for (const QFileInfo& file : files) {
+        QString code = file.completeBaseName();
+        if (code != defaultCode) {
+            institutions.append({code, readName(file.absoluteFilePath(), code), file.absoluteFilePath()});
+        }
+    }
+
+    return institutions;
+}
+
+bool InstitutionCatalog::activate(QSqlDatabase& db, const QString& code) {
+    if (hasLocalCatalog(db)) {
+        if (code != defaultCode) {
+            qDebug() << "This database keeps its own catalog; cannot switch to" << code;
+            return false;
+        }
+        return true;
+    }
+
+    QString path = catalogPath(db, code);
+    if (!QFileInfo::exists(path)) {
+        qDebug() << "No catalog installed for" << code << "at" << path;
+        return false;
+    }
+
+    QString attached = attachedCatalog(db);
+    if (!attached.isEmpty() && QFileInfo(attached) == QFileInfo(path)) {
+        return true;
+    }
+
+    QSqlQuery query(db);
+    if (!attached.isEmpty() && !query.exec("DETACH DATABASE catalog")) {
+        qDebug() << "Failed to detach catalog:" << query.lastError().text();
+        return false;
+    }
+
+    query.prepare("ATTACH DATABASE ? AS catalog");
+    query.addBindValue(QUrl::fromLocalFile(path).toString() + "?mode=ro");
+    if (!query.exec()) {
+        qDebug() << "Failed to attach catalog for" << code << ":" << query.lastError().text();
+        return false;
+    }
+
+    PrerequisiteGraph::invalidate();
+    qDebug() << "Active institution" << code;
+    return true;
+}
+
+bool InstitutionCatalog::setName(QSqlDatabase& catalogDb, const QString& code, const QString& name) {
+    QSqlQuery query(catalogDb);
+    query.prepare("INSERT OR REPLACE INTO institution (institution_code, institution_name) VALUES (?, ?)");
+    query.addBindValue(code);
+    query.addBindValue(name.isEmpty() ? code : name);
+    if (!query.exec()) {
+        qDebug() << "Failed to name institution" << code << ":" << query.lastError().text();
+        return false;
+    }
+    return true;
+}
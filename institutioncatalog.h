@@ -0,0 +1,38 @@
+#ifndef INSTITUTIONCATALOG_H
+#define INSTITUTIONCATALOG_H
+
+#include <QList>
+#include <QSqlDatabase>
+#include <QString>
+
+struct Institution {
+    QString code;
+    QString name;
+    QString path;
+};
+
+// Each institution's school/department/course tables live in their own
+// catalog file next to the user database: Catalog.db for the bundled
+// institution, catalogs/<code>.db for the rest. Only the active one is
+// ATTACHed, always as schema "catalog", so the unqualified table names in
+// MainWindow and CourseDetails resolve to it and never open another
+// institution's file. It stays attached, page cache included, until a
+// different institution is activated.
+class InstitutionCatalog
+{
+public:
+    static const QString defaultCode;
+
+    static QString catalogPath(const QSqlDatabase& db, const QString& code);
+    // Installed catalogs, the bundled one first; only that one when the
+    // database keeps its own catalog
+    static QList<Institution> available(const QSqlDatabase& db);
+
+    // Attaches the institution's catalog in place of the current one; a
+    // no-op when it is already attached. Databases that keep their own
+    // catalog in main only have the bundled institution.
+    static bool activate(QSqlDatabase& db, const QString& code);
+    static bool setName(QSqlDatabase& catalogDb, const QString& code, const QString& name);
+};
+
+#endif // INSTITUTIONCATALOG_H
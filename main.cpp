@@ -2,13 +2,20 @@
 #include "welcomewindow.h"
 #include "global_objects.h"
 #include "DatabaseInitializer.h"
+#include "catalogimporter.h"
+#include "connectionprofile.h"
+#include "institutioncatalog.h"
+#include "courseplan.h"
+#include "prerequisitegraph.h"
 
 #include <QApplication>
+#include <QCommandLineParser>
 #include <QLocale>
 #include <QTranslator>
 #include <QSqlQuery>
 #include <QDir>
 #include <QMessageBox>
+#include <QSqlError>
 
 // check if database is already initialized
 bool isDatabaseInitialized() {
@@ -21,15 +28,19 @@ bool isDatabaseInitialized() {
 }
 
 
+// Database and config file live next to the executable
+QString appFilePath(const QString& fileName) {
+    return QDir(QCoreApplication::applicationDirPath()).filePath(fileName);
+}
+
 // Main database initialization function
-bool initializeDatabase() {
-    // Get database path (next to executable)
-    QString dbPath = QDir(QCoreApplication::applicationDirPath()).filePath("DegreePlanner.db");
+bool initializeDatabase(const ConnectionProfile& profile) {
+    QString dbPath = appFilePath("DegreePlanner.db");
 
     qDebug() << "Database path:" << dbPath;
 
     // Initialize database with ALL data
-    if (!DatabaseInitializer::initializeDatabase(dbPath)) {
+    if (!DatabaseInitializer::initializeDatabase(dbPath, profile)) {
         QMessageBox::critical(nullptr, "Database Error",
                                 "Failed to initialize the database.\n"
                                 "The application cannot continue.");
@@ -41,6 +52,41 @@ bool initializeDatabase() {
     return true;
 }
 
+// Headless import of an external catalog into a standalone catalog database
+bool importCatalog(const QString& catalogPath, const QString& coursesPath, const QString& prereqsPath,
+                   const QString& institution, const QString& institutionName,
+                   const ConnectionProfile& profile) {
+    QSqlDatabase db = QSqlDatabase::addDatabase("QSQLITE", "catalog_import");
+    db.setDatabaseName(catalogPath);
+
+    if (!db.open()) {
+        qDebug() << "Cannot open catalog:" << db.lastError().text();
+        return false;
+    }
+
+    if (!profile.apply(db)) {
+        return false;
+    }
+
+    if (!DatabaseInitializer::initializeCatalog(db)) {
+        return false;
+    }
+
+    if (!institution.isEmpty() && !InstitutionCatalog::setName(db, institution, institutionName)) {
+        return false;
+    }
+
+    if (!coursesPath.isEmpty() && !CatalogImporter::importCourses(db, coursesPath)) {
+        return false;
+    }
+
+    if (!prereqsPath.isEmpty() && !CatalogImporter::importPrerequisites(db, prereqsPath)) {
+        return false;
+    }
+
+    return true;
+}
+
 int main(int argc, char *argv[])
 {
     QApplication a(argc, argv);
@@ -54,13 +100,89 @@ int main(int argc, char *argv[])
             break;
         }
     }
-    initializeDatabase();
+
+    QCommandLineParser parser;
+    parser.addHelpOption();
+    QCommandLineOption catalogOption("catalog", "Catalog database to import into.", "path");
+    QCommandLineOption importCoursesOption("import-courses", "Import courses from a CSV or JSON Lines file.", "file");
+    QCommandLineOption importPrereqsOption("import-prerequisites", "Import prerequisites from a CSV or JSON Lines file.", "file");
+    QCommandLineOption institutionOption("institution", "Import into this institution's catalog instead of --catalog.", "code");
+    QCommandLineOption institutionNameOption("institution-name", "Display name stored with --institution.", "name");
+    QCommandLineOption profileOption("db-profile", "SQLite connection profile: interactive or bulk.", "name");
+    QCommandLineOption benchmarkOption("benchmark-profiles", "Time the main window's queries under each connection profile.");
+    parser.addOption(catalogOption);
+    parser.addOption(importCoursesOption);
+    parser.addOption(importPrereqsOption);
+    parser.addOption(institutionOption);
+    parser.addOption(institutionNameOption);
+    parser.addOption(profileOption);
+    parser.addOption(benchmarkOption);
+    parser.process(a);
+
+    if (parser.isSet(importCoursesOption) || parser.isSet(importPrereqsOption)) {
+        QString catalogPath = parser.value(catalogOption);
+        QString institution = parser.value(institutionOption);
+        if (catalogPath.isEmpty() && !institution.isEmpty()) {
+            // Where InstitutionCatalog looks for it
+            QDir(QCoreApplication::applicationDirPath()).mkpath("catalogs");
+            catalogPath = appFilePath("catalogs/" + institution + ".db");
+        }
+        if (catalogPath.isEmpty()) {
+            qDebug() << "--catalog or --institution is required when importing";
+            return 1;
+        }
+        ConnectionProfile importProfile = ConnectionProfile::bulkImport();
+        if (parser.isSet(profileOption)) {
+            importProfile = ConnectionProfile::load(QString(), parser.value(profileOption));
+        }
+        return importCatalog(catalogPath,
+                             parser.value(importCoursesOption),
+                             parser.value(importPrereqsOption),
+                             institution,
+                             parser.value(institutionNameOption),
+                             importProfile) ? 0 : 1;
+    }
+
+    if (parser.isSet(benchmarkOption)) {
+        QList<ConnectionProfile> profiles;
+        profiles << ConnectionProfile::interactive() << ConnectionProfile::bulkImport()
+                 << ConnectionProfile::load(appFilePath("DegreePlanner.ini"));
+        profiles.last().name = "configured";
+        return benchmarkConnectionProfiles(appFilePath("DegreePlanner.db"), profiles, 20);
+    }
+
+    initializeDatabase(ConnectionProfile::load(appFilePath("DegreePlanner.ini"),
+                                               parser.value(profileOption)));
+
+#ifdef QT_DEBUG
+    // Catches a hot query that lost its index before it ships
+    QSqlDatabase db = QSqlDatabase::database();
+    bool plansOk = DatabaseInitializer::checkQueryPlans(db);
+    Q_ASSERT_X(plansOk, "checkQueryPlans", "a plan query no longer prepares or falls back to a full table scan");
+#endif
 
     QSqlQuery query;
-    query.exec("Select id from profile");
+    query.exec("Select id, institution from profile");
     if (query.next()){
         qDebug() << "Profile found, opening it";
         profile_id = query.value(0).toInt();
+        QSqlDatabase catalogDb = QSqlDatabase::database();
+        if (!InstitutionCatalog::activate(catalogDb, query.value(1).toString())) {
+            QMessageBox::critical(nullptr, "Database Error",
+                                  "The catalog for " + query.value(1).toString()
+                                      + " is not installed.");
+            return 1;
+        }
+
+        // A catalog imported or migrated since the plan was made can leave
+        // it with courses out of order
+        const PrerequisiteGraph& graph = PrerequisiteGraph::active();
+        CoursePlan plan(graph);
+        if (plan.load(profile_id)) {
+            for (const PlanViolation& violation : plan.validate()) {
+                qDebug() << "Plan violation:" << violation.message(graph);
+            }
+        }
     } else {
         qDebug() << "Profile not found, creating one";
     }
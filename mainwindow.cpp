@@ -1,22 +1,50 @@
 #include "mainwindow.h"
-#include "course.h"
 #include "coursedetails.h"
+#include "degreeplanner.h"
 #include "editcoursedetails.h"
 #include "global_objects.h"
 #include "newsemester.h"
+#include "planqueries.h"
+#include "prerequisitegraph.h"
 #include "qmessagebox.h"
 #include "qpushbutton.h"
 #include "qsqlquery.h"
 #include "qstyle.h"
 #include "ui_mainwindow.h"
 
+#include <QApplication>
+#include <QCoreApplication>
+#include <QFutureWatcher>
+#include <QInputDialog>
+#include <QMouseEvent>
 #include <QPixmap>
+#include <QProgressDialog>
+#include <QSet>
 #include <QSqlError>
+#include <QtConcurrent>
+#include <QWheelEvent>
+#include <algorithm>
+#include <cmath>
 
 MainWindow::MainWindow(QWidget *parent)
-    : QMainWindow(parent), ui(new Ui::MainWindow), scene(new QGraphicsScene(this)) {
+    : QMainWindow(parent), ui(new Ui::MainWindow), scene(new QGraphicsScene(this)),
+      planModel(new PlanModel(this)), cardDelegate(new CourseCardDelegate(this)) {
     ui->setupUi(this);
-    ui->tabWidget->setTabVisible(2, 0);
+    // Queued so the card isn't removed or replaced under the view's own event
+    connect(cardDelegate, &CourseCardDelegate::editRequested, this,
+            &MainWindow::onEditCourseButtonClicked, Qt::QueuedConnection);
+    connect(cardDelegate, &CourseCardDelegate::deleteRequested, this,
+            &MainWindow::onDeleteCourseButtonClicked, Qt::QueuedConnection);
+    // A semester row changes whenever one of its cards is added or removed
+    connect(planModel, &QAbstractItemModel::dataChanged, this, [this](const QModelIndex &topLeft) {
+        if (!topLeft.parent().isValid()) {
+            Semester semester = Semester::fromOrdinal(topLeft.data(PlanModel::OrdinalRole).toInt());
+            updateSemesterStatus(semester);
+            board->refreshRow(board->rowOf(semester));
+        }
+    });
+    projectionSettings = GraduationProjection::Settings::load(
+        QCoreApplication::applicationDirPath() + "/DegreePlanner.ini");
     ui->tabWidget->setTabVisible(3, 0);
     ui->frame_5->setVisible(0);
     QPixmap pix(":icons/trending.png");
@@ -32,24 +60,46 @@ MainWindow::MainWindow(QWidget *parent)
         ":icons/target.png");
     ui->icon_track->setPixmap(pix3);
 
-    ui->verticalLayout_12->setObjectName("semesetersLayout");
+    setupBoard();
+    ui->graphicsView->setScene(scene);
+    ui->graphicsView->setDragMode(QGraphicsView::ScrollHandDrag);
+    ui->graphicsView->setTransformationAnchor(QGraphicsView::AnchorUnderMouse);
+    ui->graphicsView->setViewportUpdateMode(QGraphicsView::SmartViewportUpdate);
+    ui->graphicsView->setRenderHint(QPainter::Antialiasing);
+    ui->graphicsView->viewport()->installEventFilter(this);
     if(profile_id != -1){
-        updateGPA();
-        updateCreditsEarned();
-        updateSemsLeft();
-        populateSemesters();
-        populateGraphics();
+        refreshWindow();
     } else return;
 }
 
 MainWindow::~MainWindow() { delete ui; }
 
+// Reloads only what changed since the window was last brought up to date;
+// when nothing did, it doesn't touch the database at all
 void MainWindow::refreshWindow(){
+    const PrerequisiteGraph &graph = PrerequisiteGraph::active();
+    if (profile_id == shownProfile && graph.version() == shownGraphVersion) {
+        if (plan_revision != shownRevision) {
+            patchSemesters();
+            updateCounters();
+        }
+        return;
+    }
+
+    // Another profile or another catalog: nothing shown carries over
+    shownProfile = profile_id;
+    shownGraphVersion = graph.version();
+    populateSemesters();
+    updateCounters();
+}
+
+// Everything computed from the plan rather than read for it
+void MainWindow::updateCounters(){
     updateGPA();
     updateCreditsEarned();
     updateSemsLeft();
-    populateSemesters();
     populateGraphics();
+    shownRevision = plan_revision;
 }
 
 AcademicStanding MainWindow::getStandingFromGPA(double gpa) {
@@ -66,29 +116,40 @@ AcademicStanding MainWindow::getStandingFromGPA(double gpa) {
 }
 
 void MainWindow::populateSemesters() {
-    QSqlQuery query;
-
-    int starting_year;
-    query.exec("Select starting_year from profile");
-    query.next();
-    starting_year = query.value(0).toInt();
-
-    QString starting_semester;
-    query.exec("Select starting_semester from profile");
-    query.next();
-    starting_semester = query.value(0).toString();
+    semesterFrames.clear();
+    plan.reset(new CoursePlan(PrerequisiteGraph::active()));
+    plan->load(profile_id);
+    requirements.reset(new DegreeRequirements(PrerequisiteGraph::active()));
+    if (!requirements->load(profile_id)) {
+        requirements.reset();
+    }
+
+    // Rows are laid out from the snapshot alone; the board only builds the
+    // ones on screen
+    PlanSnapshot snapshot;
+    snapshot.load(profile_id);
+    planModel->load(snapshot);
+    board->setRows(yearRows(snapshot));
+    for (int course = 0; course < PrerequisiteGraph::active().courseCount(); ++course) {
+        if (plan->semesterOf(course).isValid()) {
+            markCourseCard(course);
+        }
+    }
+}
 
-    // Get last year
-    int lastYear;
-    query.exec("Select graduation_year from profile");
-    query.next();
-    lastYear = query.value(0).toInt();
+// The board and the buttons under it; its rows come from populateSemesters
+void MainWindow::setupBoard() {
+    board = new PlanBoard(
+        ui->scrollArea,
+        [this](QWidget *parent) { return createYearFrame(parent); },
+        [this](QWidget *row, int index, const PlanBoard::Row &data) { bindYearFrame(row, index, data); },
+        [this](const PlanBoard::Row &data) { return estimateYearFrame(data); });
 
-    for (int year = starting_year; year <= lastYear; year++) {
-        createYearFrame(year, starting_semester);
-    }
+    QWidget *footer = new QWidget();
+    QVBoxLayout *footerLayout = new QVBoxLayout(footer);
+    footerLayout->setContentsMargins(0, 0, 0, 0);
 
-    QPushButton *add_sem_button = new QPushButton("+ Add Semester", this);
+    QPushButton *add_sem_button = new QPushButton("+ Add Semester");
     add_sem_button->setStyleSheet(R"(
     QPushButton {
         background-color: transparent;
@@ -117,61 +178,180 @@ void MainWindow::populateSemesters() {
     connect(add_sem_button, &QPushButton::clicked, this,
             [=]() { onAddSemButtonClicked(); });
 
-    ui->verticalLayout_12->addWidget(add_sem_button);
+    footerLayout->addWidget(add_sem_button);
+
+    QPushButton *auto_plan_button = new QPushButton("Plan remaining courses");
+    auto_plan_button->setStyleSheet(add_sem_button->styleSheet());
+    connect(auto_plan_button, &QPushButton::clicked, this,
+            [=]() { onAutoPlanButtonClicked(); });
+
+    footerLayout->addWidget(auto_plan_button);
+    board->setFooter(footer);
 }
 
-void MainWindow::createYearFrame(int year, QString starting_semester){
-    QFrame *frame = new QFrame(this);
-    frame->setObjectName("yearFrame");
+// Brings the board in line with a fresh snapshot, touching only the cards
+// that were added, removed, moved or edited since it was last shown
+void MainWindow::patchSemesters() {
+    PlanSnapshot snapshot;
+    if (!snapshot.load(profile_id)) {
+        return;
+    }
+    const PrerequisiteGraph &graph = PrerequisiteGraph::active();
 
-    // ** Horizontal Layout for the main frame
-    QHBoxLayout *frameLayout = new QHBoxLayout(frame);
-    frameLayout->setObjectName("yearFrameLayout");
+    QSet<QString> present;
+    QList<int> changed;
+    for (int ordinal : snapshot.ordinals()) {
+        for (const CourseCard &card : snapshot.cards(Semester::fromOrdinal(ordinal))) {
+            present.insert(card.code);
+            QModelIndex index = planModel->cardIndex(card.code);
+            if (index.isValid() && planModel->card(index) == card) {
+                continue;
+            }
+            if (index.isValid() && planModel->card(index).semOrdinal == card.semOrdinal) {
+                planModel->replaceCard(card.code, card);
+            } else {
+                planModel->addCard(card);
+            }
+            int course = graph.courseId(card.code);
+            if (course >= 0) {
+                plan->place(course, Semester::fromOrdinal(card.semOrdinal));
+                plan->setCompleted(course, card.done);
+                changed.append(course);
+            }
+        }
+    }
+    for (const CourseCard &card : planModel->cards()) {
+        if (!present.contains(card.code)) {
+            planModel->removeCard(card.code);
+            int course = graph.courseId(card.code);
+            if (course >= 0) {
+                plan->remove(course);
+                changed.append(course);
+            }
+        }
+    }
 
+    // New summers get their frame. Semesters added on the board that have
+    // no courses yet aren't in the snapshot, so they are merged back in.
+    QVector<PlanBoard::Row> rows = yearRows(snapshot);
+    for (int index = 0; index < rows.size(); ++index) {
+        if (index >= board->rows().size()) {
+            board->appendRow(rows[index]);
+            continue;
+        }
+        PlanBoard::Row row = rows[index];
+        for (const Semester &semester : board->rows()[index].semesters) {
+            if (!row.semesters.contains(semester)) {
+                row.semesters.append(semester);
+            }
+            if (semester.term() == Semester::Summer) {
+                row.summerYear = -1;
+            }
+        }
+        std::sort(row.semesters.begin(), row.semesters.end());
+        if (board->rows()[index] != row) {
+            board->setRow(index, row);
+        }
+    }
+
+    for (int course : changed) {
+        if (plan->semesterOf(course).isValid()) {
+            markCourseCard(course);
+        }
+        revalidateAffected(course);
+    }
+    qDebug() << "Refreshed" << changed.size() << "changed courses";
+}
+
+QVector<PlanBoard::Row> MainWindow::yearRows(const PlanSnapshot &snapshot){
+    QVector<PlanBoard::Row> rows;
+    for (int year = snapshot.startingYear(); year <= snapshot.graduationYear(); year++) {
+        rows.append(yearRow(year, snapshot.startingSemester()));
+    }
+    return rows;
+}
+
+PlanBoard::Row MainWindow::yearRow(int year, QString starting_semester){
+    PlanBoard::Row row;
     bool hasSummer = hasSummerSemester(year);
 
     if(!hasSummer){
         //no summer session, don't print it
         if(starting_semester == "SPRING"){
-            createSemesterFrame(frameLayout, year+1, "SPRING");
-            addAddSummerButton(frameLayout, year);
+            row.semesters = {Semester(year+1, Semester::Spring)};
         } else{
-            createSemesterFrame(frameLayout, year, "FALL");
-            createSemesterFrame(frameLayout, year+1, "SPRING");
-            addAddSummerButton(frameLayout, year);
+            row.semesters = {Semester(year, Semester::Fall), Semester(year+1, Semester::Spring)};
         }
+        row.summerYear = year;
     } else{
         if(starting_semester == "SPRING"){
-            createSemesterFrame(frameLayout, year+1, "SPRING");
-            createSemesterFrame(frameLayout, year+1, "SUMMER");
+            row.semesters = {Semester(year+1, Semester::Spring), Semester(year+1, Semester::Summer)};
         } else if(starting_semester == "SUMMER"){
-            createSemesterFrame(frameLayout, year+1, "SUMMER");
+            row.semesters = {Semester(year+1, Semester::Summer)};
         } else{
-            createSemesterFrame(frameLayout, year, "FALL");
-            createSemesterFrame(frameLayout, year+1, "SPRING");
-            createSemesterFrame(frameLayout, year+1, "SUMMER");
+            row.semesters = {Semester(year, Semester::Fall), Semester(year+1, Semester::Spring),
+                             Semester(year+1, Semester::Summer)};
         }
     }
+    return row;
+}
 
-    ui->verticalLayout_12->addWidget(frame);
+// An empty year row with room for three semesters; bindYearFrame fills it
+// in and the board reuses it for whichever year scrolls into view next
+QWidget *MainWindow::createYearFrame(QWidget *parent){
+    QFrame *frame = new QFrame(parent);
+    frame->setObjectName("yearFrame");
+
+    // ** Horizontal Layout for the main frame
+    QHBoxLayout *frameLayout = new QHBoxLayout(frame);
+    frameLayout->setObjectName("yearFrameLayout");
+
+    for (int slot = 0; slot < 3; ++slot) {
+        frameLayout->addWidget(createSemesterFrame());
+    }
+    addAddSummerButton(frameLayout);
+    return frame;
+}
+
+void MainWindow::bindYearFrame(QWidget *row, int index, const PlanBoard::Row &data){
+    row->setProperty("boardRow", index);
+    QHBoxLayout *frameLayout = static_cast<QHBoxLayout *>(row->layout());
+    for (int slot = 0; slot < 3; ++slot) {
+        QFrame *frame = static_cast<QFrame *>(frameLayout->itemAt(slot)->widget());
+        int previous = frame->property("semOrdinal").toInt();
+        if (semesterFrames.value(previous) == frame) {
+            semesterFrames.remove(previous);
+        }
+        if (slot >= data.semesters.size()) {
+            frame->setProperty("semOrdinal", -1);
+            frame->hide();
+            continue;
+        }
+        const Semester &key = data.semesters[slot];
+        // Summers sit centered between the taller Fall and Spring frames
+        frameLayout->setAlignment(frame, key.term() == Semester::Summer ? Qt::AlignVCenter
+                                                                        : Qt::Alignment());
+        bindSemesterFrame(frame, key);
+        frame->show();
+    }
+    row->findChild<QPushButton *>("addSummerButton")->setVisible(data.summerYear >= 0);
+}
+
+int MainWindow::estimateYearFrame(const PlanBoard::Row &data){
+    int cards = 0;
+    for (const Semester &semester : data.semesters) {
+        cards = qMax(cards, planModel->cardCount(semester));
+    }
+    // Title bar, then either the cards or the "no courses" placeholder
+    return 110 + (cards > 0 ? cards * CourseCardDelegate::cardHeight : 160);
 }
 
 bool MainWindow::hasSummerSemester(int year){
     //check if year has a summer session
-    QSqlQuery query;
-    query.prepare("SELECT DISTINCT s.sem_term, s.sem_year "
-                  "FROM course_planning cp INNER JOIN semester s "
-                  "on cp.sem_code = s.sem_code "
-                  "WHERE s.sem_term = :sem_term and sem_year = :year");
-    query.bindValue(":sem_term", "SUMMER");
-    query.bindValue(":year", year+1);
-    query.exec();
-
-    if(!query.next()) return false;
-    else return true;
+    return planModel->cardCount(Semester(year + 1, Semester::Summer)) > 0;
 }
 
-void MainWindow::addAddSummerButton(QHBoxLayout* layout, int year){
+void MainWindow::addAddSummerButton(QHBoxLayout* layout){
     QPushButton *addSummerButton = new QPushButton("+");
     addSummerButton->setObjectName("addSummerButton");
     addSummerButton->setToolTip("Add Summer Semester");
@@ -197,23 +377,19 @@ void MainWindow::addAddSummerButton(QHBoxLayout* layout, int year){
     )");
 
     layout->addWidget(addSummerButton);
-    connect(addSummerButton, &QPushButton::clicked, this,[=]() {
-        onAddSemButtonClicked(layout, year, addSummerButton); });
+    // The row is recycled, so which one it is gets read at click time
+    QWidget *row = layout->parentWidget();
+    connect(addSummerButton, &QPushButton::clicked, this, [=]() {
+        onAddSummerButtonClicked(row->property("boardRow").toInt()); });
 }
 
-void MainWindow::createSemesterFrame(QHBoxLayout* yearFrame, int year, QString semester) {
-    QFrame *frame_with_spacers = new QFrame();
-    QVBoxLayout *SpacersFrameLayout = nullptr;
-    frame_with_spacers->setFrameStyle(QFrame::NoFrame);
+// A semester frame with no semester yet; see bindSemesterFrame
+QFrame *MainWindow::createSemesterFrame() {
     // * Main semester frame
-    QFrame *frame;
-    if(semester == "SUMMER") {
-        frame = new QFrame(frame_with_spacers);
-        SpacersFrameLayout = new QVBoxLayout(frame_with_spacers);
-    }
-    else frame = new QFrame();
+    QFrame *frame = new QFrame();
     frame->setFrameStyle(QFrame::StyledPanel);
     frame->setObjectName("semesterFrame");
+    frame->setProperty("semOrdinal", -1);
 
     // ** Vertical Layout for the main frame
     QVBoxLayout *frameLayout = new QVBoxLayout(frame);
@@ -231,14 +407,11 @@ void MainWindow::createSemesterFrame(QHBoxLayout* yearFrame, int year, QString s
     QLabel *semesterTitle = new QLabel();
     semesterTitle->setObjectName("semesterTitle");
     semesterTitle->setMinimumHeight(30);
-    semesterTitle->setText(semester + " " + QString::number(year));
     semesterTitle->setFont(QFont("Segoe UI", 16, QFont::Bold));
 
     QLabel *semesterStatus = new QLabel();
     semesterStatus->setObjectName("semesterStatus");
 
-    // QObject *semesterParent = findParent(semesterStatus, "semesterFrame");
-
     semNameFrameLayout->addWidget(semesterTitle);
     semNameFrameLayout->addWidget(semesterStatus);
 
@@ -270,9 +443,9 @@ void MainWindow::createSemesterFrame(QHBoxLayout* yearFrame, int year, QString s
         "    border: 1px solid #555555;"
         "}"));
 
+    // The frame is recycled, so its semester is read at click time
     connect(button, &QPushButton::clicked, this, [=]() {
-        onAddCourseButtonClicked(frame, frameLayout,
-                                 semester + " " + QString::number(year));
+        onAddCourseButtonClicked(Semester::fromOrdinal(frame->property("semOrdinal").toInt()));
     });
     // *** Add semester frame name and button and horizontal spacer to the whole
     // semester title frame
@@ -321,8 +494,7 @@ void MainWindow::createSemesterFrame(QHBoxLayout* yearFrame, int year, QString s
     addFirstCourseButton->setFont(QFont("Segoe UI", 13));
 
     connect(addFirstCourseButton, &QPushButton::clicked, this, [=]() {
-        onFirstAddCourseButtonClicked(frame, frameLayout, noCoursesFrame,
-                                      semester + QString::number(year));
+        onAddCourseButtonClicked(Semester::fromOrdinal(frame->property("semOrdinal").toInt()));
     });
 
     // **** Add elements to layout
@@ -334,510 +506,163 @@ void MainWindow::createSemesterFrame(QHBoxLayout* yearFrame, int year, QString s
     frameLayout->addWidget(titleFrame);
     frameLayout->addWidget(noCoursesFrame);
 
-    if(semester == "SUMMER"){
-        SpacersFrameLayout->addStretch();
-        SpacersFrameLayout->addWidget(frame);
-        SpacersFrameLayout->addStretch();
-    }
-
-    QSqlQuery query;
-    // Add existing courses
-    query.prepare(
-        "Select course_code from course_planning "
-        "inner join semester on semester.sem_code = course_planning.sem_code "
-        "where sem_year = :year and sem_term = :semester");
-    query.bindValue(":year", year);
-    query.bindValue(":semester", semester.toUpper());
-    query.exec();
-    while (query.next()) {
-        QString course_code = query.value(0).toString();
-        addCoursesFromDatabase(frame, frameLayout, course_code);
-    }
-
-    // * Add the semester frame to the vertical layout of scrollable area
-    //ui->verticalLayout_12->addWidget(frame);
-    if(semester == "SUMMER") yearFrame->addWidget(frame_with_spacers);
-    else yearFrame->addWidget(frame);
-
-    updateSemesterStatus(frame, semester + QString::number(year));
+    // Existing courses, painted from the model
+    CourseCardView *cards = new CourseCardView(planModel, cardDelegate, frame);
+    frameLayout->addWidget(cards);
+    return frame;
 }
 
-void MainWindow::createSemesterFrame(int year, QString semester) {
-    // * Main semester frame
-    QFrame *frame = new QFrame(this);
-    frame->setFrameStyle(QFrame::StyledPanel);
-    frame->setSizePolicy(QSizePolicy::Preferred, QSizePolicy::Preferred);
-    frame->setObjectName("semesterFrame");
-
-    // ** Vertical Layout for the main frame
-    QVBoxLayout *frameLayout = new QVBoxLayout(frame);
-    frameLayout->setObjectName("semesterFrameLayout");
-
-    // *** Frame for the semester title
-    QFrame *titleFrame = new QFrame();
-    titleFrame->setMinimumHeight(80);
-    titleFrame->setMinimumWidth(1122);
-    titleFrame->setMaximumHeight(80);
-    titleFrame->setMaximumHeight(1122);
-
-    // Horizontal Layout for the semester title frame
-    QHBoxLayout *titleFrameLayout = new QHBoxLayout(titleFrame);
-
-    // **** Frame for the semester name and courses status
-    QFrame *semNameFrame = new QFrame();
-    QVBoxLayout *semNameFrameLayout = new QVBoxLayout(semNameFrame);
-    QLabel *semesterTitle = new QLabel();
-    semesterTitle->setObjectName("semesterTitle");
-    semesterTitle->setMinimumHeight(30);
-    semesterTitle->setText(semester + " " + QString::number(year));
-    semesterTitle->setFont(QFont("Segoe UI", 16, QFont::Bold));
-
-    QLabel *semesterStatus = new QLabel();
-    semesterStatus->setObjectName("semesterStatus");
-
-    // QObject *semesterParent = findParent(semesterStatus, "semesterFrame");
-
-    semNameFrameLayout->addWidget(semesterTitle);
-    semNameFrameLayout->addWidget(semesterStatus);
-
-    // **** Button to add courses
-    QPushButton *button = new QPushButton("+ Add Course");
-    button->setStyleSheet(QStringLiteral(
-        "QPushButton {"
-        "    background-color: #2E2E2E;       /* Deep charcoal base */"
-        "    color: #FFFFFF;                  /* Crisp white text */"
-        "    border: 1px solid #555555;       /* Subtle border */"
-        "    border-radius: 6px;              /* Smooth rounded corners */"
-        "    padding: 6px 12px;               /* Comfortable spacing */"
-        "    font-size: 14px;                 /* Clean, readable font */"
-        "}"
-        ""
-        "QPushButton:hover {"
-        "    background-color: #3E3E3E;       /* Slightly lighter on hover */"
-        "    border: 1px solid #777777;       /* Highlight border */"
-        "}"
-        ""
-        "QPushButton:pressed {"
-        "    background-color: #1E1E1E;       /* Darker when pressed */"
-        "    border: 1px solid #999999;       /* Stronger border */"
-        "}"
-        ""
-        "QPushButton:disabled {"
-        "    background-color: #444444;       /* Muted tone */"
-        "    color: #AAAAAA;                  /* Dimmed text */"
-        "    border: 1px solid #555555;"
-        "}"));
-
-    connect(button, &QPushButton::clicked, this, [=]() {
-        onAddCourseButtonClicked(frame, frameLayout,
-                                 semester + " " + QString::number(year));
-    });
-    // *** Add semester frame name and button and horizontal spacer to the whole
-    // semester title frame
-    titleFrameLayout->addWidget(semNameFrame);
-    titleFrameLayout->addStretch();
-    titleFrameLayout->addWidget(button);
-
-    // *** Frame for the no courses yet
-    QFrame *noCoursesFrame = new QFrame();
-    noCoursesFrame->setObjectName("noCoursesFrame");
-    noCoursesFrame->setSizePolicy(QSizePolicy::Preferred, QSizePolicy::Preferred);
-    noCoursesFrame->setStyleSheet(
-        "background-color: #363636; border-radius: 8px; border: 1px #4a4a4a;");
-
-    // **** Add Vertical Layout for the elements inside the no courses frame
-    QVBoxLayout *noCoursesFrameLayout = new QVBoxLayout(noCoursesFrame);
-
-    // Elements
-    QLabel *icon = new QLabel();
-    QPixmap pix4(":icons/closed_book.png");
-    icon->setPixmap(pix4);
-    icon->setAlignment(Qt::AlignCenter);
-    QLabel *textLabel = new QLabel();
-    textLabel->setText("No courses planned for this semester");
-    textLabel->setFont(QFont("Segoe UI", 13));
-    textLabel->setAlignment(Qt::AlignCenter);
-    QPushButton *addFirstCourseButton = new QPushButton();
-    addFirstCourseButton->setText("Add your first course");
-    addFirstCourseButton->setStyleSheet(R"(
-    QPushButton {
-        background-color: transparent;
-        border: none;
-        color: #4fc3f7;           /* Light blue - good visibility on dark background */
-        padding: 2px 4px;
-        text-decoration: underline;
-    }
-
-    QPushButton:hover {
-        color: #29b6f6;           /* Slightly brighter blue on hover */
-        text-decoration: none;
-    }
-
-    QPushButton:pressed {
-        color: #81d4fa;           /* Even lighter blue when pressed */
-    })");
-    addFirstCourseButton->setFont(QFont("Segoe UI", 13));
-
-    connect(addFirstCourseButton, &QPushButton::clicked, this, [=]() {
-        onFirstAddCourseButtonClicked(frame, frameLayout, noCoursesFrame,
-                                      semester + QString::number(year));
-    });
-
-    // **** Add elements to layout
-    noCoursesFrameLayout->addWidget(icon);
-    noCoursesFrameLayout->addWidget(textLabel);
-    noCoursesFrameLayout->addWidget(addFirstCourseButton);
-
-    // ** Add title Frame to the Vertical Layout
-    frameLayout->addWidget(titleFrame);
-    frameLayout->addWidget(noCoursesFrame);
-
-    QSqlQuery query;
-    // Add existing courses
-    query.prepare(
-        "Select course_code from course_planning "
-        "inner join semester on semester.sem_code = course_planning.sem_code "
-        "where sem_year = :year and sem_term = :semester");
-    query.bindValue(":year", year);
-    query.bindValue(":semester", semester.toUpper());
-    query.exec();
-    while (query.next()) {
-        QString course_code = query.value(0).toString();
-        addCoursesFromDatabase(frame, frameLayout, course_code);
-    }
-
-    // * Add the semester frame to the vertical layout of scrollable area
-    ui->verticalLayout_12->addWidget(frame);
-    updateSemesterStatus(frame, semester + QString::number(year));
+// Points a semester frame at its semester's title, status and cards
+void MainWindow::bindSemesterFrame(QFrame *frame, const Semester &key) {
+    // Names the frame's semester without parsing the title
+    frame->setProperty("semOrdinal", key.ordinal());
+    frame->findChild<QLabel *>("semesterTitle")->setText(key.title());
+    frame->findChild<CourseCardView *>()->setRootIndex(planModel->addSemester(key));
+    semesterFrames.insert(key.ordinal(), frame);
+    updateSemesterStatus(key);
 }
 
-bool MainWindow::onAddCourseButtonClicked(QFrame *source, QLayout *sourceLayout,
-                                          QString semester) {
-    CourseDetails w(semester, this);
+bool MainWindow::onAddCourseButtonClicked(Semester semester) {
+    CourseDetails w(semester, *plan, this);
     bool activated = w.exec();
 
     if (activated) {
         QString course_code = w.getCourseCode();
-        addCoursesFromDatabase(source, sourceLayout, course_code);
-        updateSemesterStatus(source, semester.remove(' '));
+        int course = PrerequisiteGraph::active().courseId(course_code);
+        plan->place(course, semester);
+        plan->setCompleted(course, std::get<2>(w.getCourseStatus()));
+        addCoursesFromDatabase(course_code);
+        revalidateAffected(course);
+        updateCounters();
         return true;
     } else return false;
 }
 
-void MainWindow::onFirstAddCourseButtonClicked(QFrame *frame,
-                                               QLayout *sourceLayout,
-                                               QFrame *noCoursesFrame,
-                                               QString semester) {
-    if(onAddCourseButtonClicked(frame, sourceLayout, semester)) noCoursesFrame->hide();
-}
-
-void MainWindow::addCoursesFromDatabase(QFrame *source, QLayout *sourceLayout,
-                                        QString course_code) {
-    // Check if no courses frame is showen
-    QFrame *noCoursesFrame = source->findChild<QFrame *>("noCoursesFrame");
-    if (noCoursesFrame && !noCoursesFrame->isHidden()) {
-        noCoursesFrame->hide();
+// The card's semester frame follows through PlanModel::dataChanged. A card
+// that can't be read belongs to no semester, so it isn't added at all.
+void MainWindow::addCoursesFromDatabase(QString course_code) {
+    CourseCard card;
+    if (!CourseCard::load(course_code, card)) {
+        qDebug() << "Not showing" << course_code << ": its card couldn't be read";
+        return;
     }
+    planModel->addCard(card);
+    markCourseCard(PrerequisiteGraph::active().courseId(course_code));
+}
 
-    // Frame for each course
-    QFrame *courseFrame = new QFrame(source);
-    courseFrame->setObjectName("courseFrame");
-
-    courseFrame->setFrameStyle(QFrame::StyledPanel);
-    courseFrame->setMinimumHeight(143);
-
-    // Create a layout for the frame
-    QVBoxLayout *crouseFrameLayout = new QVBoxLayout(courseFrame);
-    crouseFrameLayout->setObjectName("crouseFrameLayout");
-
-    // Frame for title card
-    QFrame *titleFrame = new QFrame();
-    titleFrame->setMinimumHeight(48);
-    titleFrame->setObjectName("titleFrame");
-
-    QHBoxLayout *titleFrameLayout = new QHBoxLayout(titleFrame);
-
-    // Course labels structure
-    course course_labels;
-
-    // Course Title
-    course_labels.titleLabel = new QLabel(titleFrame);
-    course_labels.titleLabel->setObjectName("titleLabel");
-
-    titleFrameLayout->addWidget(course_labels.titleLabel);
-    course_labels.titleLabel->setText(course_code);
-    course_labels.titleLabel->setFont(QFont("Segoe UI", 19, QFont::Bold));
-
-    crouseFrameLayout->addWidget(titleFrame);
-
-    // Status for each semester
-    course_labels.statusLabel = new QLabel();
-
-    titleFrameLayout->addWidget(course_labels.statusLabel);
-
-    // The edit button
-    QPushButton *edit_button = new QPushButton;
-    edit_button->setObjectName("edit_button");
-    edit_button->setStyleSheet(R"(
-    QPushButton {
-        background: transparent;
-        border: none;
-        color: black;
-    }
-    QPushButton:hover {
-        background-color: rgba(0, 0, 0, 30);
-        border: 1px solid rgba(0, 0, 0, 50);
-        border-radius: 4px;
-    }
-    QPushButton:pressed {
-        background-color: rgba(0, 0, 0, 50);
-    }
-    )");
-    QPixmap edit_button_icon(
-        ":icons/edit.png");
-    edit_button->setIcon(edit_button_icon);
-    edit_button->setHidden(1);
-
-    // The delete button
-    QPushButton *delete_button = new QPushButton;
-    delete_button->setObjectName("delete_button");
-    delete_button->setStyleSheet(R"(
-    QPushButton {
-        background: transparent;
-        border: none;
-        color: black;
-    }
-    QPushButton:hover {
-        background-color: rgba(0, 0, 0, 30);
-        border: 1px solid rgba(0, 0, 0, 50);
-        border-radius: 4px;
-    }
-    QPushButton:pressed {
-        background-color: rgba(0, 0, 0, 50);
+void MainWindow::onDeleteCourseButtonClicked(const QString &course_code) {
+    // Planned courses that needed this one lose their prerequisite
+    const PrerequisiteGraph &graph = PrerequisiteGraph::active();
+    int removed = graph.courseId(course_code);
+    Semester removedFrom = plan->semesterOf(removed);
+    plan->remove(removed);
+    QStringList broken;
+    for (int dependent : plan->affectedBy(removed)) {
+        for (const PlanViolation &violation : plan->check(dependent, plan->semesterOf(dependent))) {
+            if (violation.prerequisite == removed) {
+                broken.append(violation.message(graph));
+            }
+        }
     }
-    )");
-    QPixmap delete_button_icon(
-        ":icons/delete.png");
-    delete_button->setIcon(delete_button_icon);
-    delete_button->setHidden(1);
-
-    connect(delete_button, &QPushButton::clicked, this,
-            [=]() { onDeleteCourseButtonClicked(courseFrame); });
-
-    // add a horizontal spacer first between the buttons and the label
-    titleFrameLayout->addStretch();
-    titleFrameLayout->addWidget(edit_button);
-    titleFrameLayout->addWidget(delete_button);
-
-    QString semester;
-    if (edit_button->parent()->parent()->parent()) {
-        semester = edit_button->parent()
-                       ->parent()
-                       ->parent()
-                       ->findChild<QLabel *>("semesterTitle")
-                       ->text();
+    if (!broken.isEmpty() &&
+        QMessageBox::question(this, "Remove course",
+                              course_code + " is required by other planned courses:\n"
+                                  + broken.join("\n") + "\n\nRemove it anyway?") != QMessageBox::Yes) {
+        plan->place(removed, removedFrom);
+        return;
     }
 
     QSqlQuery query;
-    query.prepare("Select course_code, is_current_course, is_planned_course, "
-                  "is_done_course from course_planning "
-                  "where course_code = :course_code");
+    query.prepare(PlanQueries::deletePlannedCourse);
     query.bindValue(":course_code", course_code);
-    query.exec();
-    int c_is_complete = 0;
-    int c_is_planned = 0;
-    int c_is_current = 0;
-
-    if (query.next()) {
-        c_is_current = query.value("is_current_course").toInt();
-        c_is_planned = query.value("is_planned_course").toInt();
-        c_is_complete = query.value("is_done_course").toInt();
-    } else {
-        // Handle case where no results found
-        qDebug() << "No course found with code:" << course_code;
-    }
-
-    auto [status, style_sheet] =
-        getCourseStatus(c_is_complete, c_is_current, c_is_planned);
-    course_labels.statusLabel->setText(status);
-    course_labels.statusLabel->setStyleSheet(style_sheet);
-    course_labels.statusLabel->setMinimumHeight(33);
-
-    // Course desc
-    QFrame *c_desc_frame = new QFrame();
-
-    QVBoxLayout *descFrameLayout = new QVBoxLayout(c_desc_frame);
-    course_labels.desc = new QLabel();
-    descFrameLayout->addWidget(course_labels.desc);
-    course_labels.desc->setAlignment(Qt::AlignCenter);
-    query.prepare(
-        "Select course_title from course where course_code = :course_code");
-    query.bindValue(":course_code", course_code);
-    query.exec();
-    QString description;
-    if (query.next()) {
-        description = query.value(0).toString();
+    if (!query.exec()) {
+        plan->place(removed, removedFrom);
+        QMessageBox::critical(this, "Remove course", query.lastError().text());
+        return;
     }
-    course_labels.desc->setText(description);
-    course_labels.desc->setAlignment(Qt::AlignLeft);
-
-    crouseFrameLayout->addWidget(c_desc_frame);
-
-    // Frame for course status
-    QFrame *statusFrame = new QFrame();
-    statusFrame->setMaximumHeight(44);
-    statusFrame->setMaximumWidth(214);
+    ++plan_revision;
+    planModel->removeCard(course_code);
+    revalidateAffected(removed);
+    updateCounters();
+}
 
-    // Create a layout for the frame
-    QHBoxLayout *statusframeLayout = new QHBoxLayout(statusFrame);
+void MainWindow::onEditCourseButtonClicked(const QString &course_code) {
+    const PrerequisiteGraph &graph = PrerequisiteGraph::active();
+    int old_course = graph.courseId(course_code);
+    Semester planned = plan->semesterOf(old_course);
+    EditCourseDetails w(course_code, planned.title(), *plan, this);
+    bool activated = w.exec();
 
-    query.prepare(
-        "Select course_credits from course where course_code = :course_code");
-    query.bindValue(":course_code", course_code);
-    query.exec();
-    QString credits_number;
-    if (query.next()) {
-        credits_number = query.value(0).toString();
+    if (activated) {
+        // The card now shows the replacement, in the same semester
+        QString new_code = w.getCourseCode();
+        int new_course = graph.courseId(new_code);
+        plan->remove(old_course);
+        plan->place(new_course, planned);
+        plan->setCompleted(new_course, w.getCourseDone());
+        CourseCard card;
+        if (CourseCard::load(new_code, card)) {
+            planModel->replaceCard(course_code, card);
+            markCourseCard(new_course);
+        } else {
+            // The old card is gone from the database either way
+            qDebug() << "Not showing" << new_code << ": its card couldn't be read";
+            planModel->removeCard(course_code);
+        }
+        revalidateAffected(old_course);
+        revalidateAffected(new_course);
+        updateCounters();
     }
+}
 
-    course_labels.credits = new QLabel();
-    course_labels.credits->setText(credits_number + " credits");
-
-    query.prepare(
-        "Select course_level from course where course_code = :course_code");
-    query.bindValue(":course_code", course_code);
-    query.exec();
-    QString course_level;
-    if (query.next()) {
-        course_level = query.value(0).toString();
+// Shows on a card's status pill which of its requirements the plan is
+// missing, or restores the pill once there are none
+void MainWindow::markCourseCard(int course) {
+    const PrerequisiteGraph &graph = PrerequisiteGraph::active();
+    if (course < 0 || !plan) {
+        return;
     }
 
-    course_labels.level = new QLabel();
-    course_labels.level->setText(course_level);
-
-    query.prepare(
-        "Select grade from course_planning where course_code = :course_code");
-    query.bindValue(":course_code", course_code);
-    query.exec();
-    QString course_grade;
-    if (query.next()) {
-        course_grade = query.value(0).toString();
+    QStringList messages;
+    for (const PlanViolation &violation : plan->check(course, plan->semesterOf(course))) {
+        messages.append(violation.message(graph));
     }
-
-    course_labels.grade = new QLabel();
-    course_labels.grade->setText("Grade: " + course_grade);
-
-    statusframeLayout->addWidget(course_labels.credits);
-    statusframeLayout->addWidget(course_labels.level);
-    statusframeLayout->addWidget(course_labels.grade);
-
-    crouseFrameLayout->addWidget(statusFrame);
-
-    courseFrame->installEventFilter(this);
-
-    sourceLayout->addWidget(courseFrame);
-    QString rawSemester = semester.remove(' ');
-    connect(edit_button, &QPushButton::clicked, this, [=]() {
-        onEditCourseButtonClicked(courseFrame, course_labels, semester);
-        updateSemesterStatus(source, rawSemester);
-    });
+    planModel->setViolations(graph.courseCode(course), messages);
 }
 
-std::tuple<QString, QString>
-MainWindow::getCourseStatus(bool is_done, bool is_current, bool is_planned) {
-    QString style_sheet;
-
-    if (is_done) {
-        style_sheet = "QLabel { background-color: #4CAF50; "
-                      "color: white; border-radius: 8px; padding: 6px 12px; "
-                      "font-weight: bold; font-size: 14px; "
-                      "border: 1px solid #388E3C; "
-                      "qproperty-alignment: AlignCenter; }";
-        return {"Completed", style_sheet};
-    } else if (is_current) {
-        style_sheet = "QLabel { background-color: #2196F3; "
-                      "color: white; border-radius: 8px; padding: 6px 12px; "
-                      "font-weight: bold; font-size: 14px; "
-                      "border: 1px solid #1976D2; "
-                      "qproperty-alignment: AlignCenter; }";
-        return {"Current", style_sheet};
-    } else if (is_planned) {
-        style_sheet = "QLabel { background-color: #9C27B0; "
-                      "color: white; border-radius: 8px; padding: 6px 12px; "
-                      "font-weight: bold; font-size: 14px; "
-                      "border: 1px solid #7B1FA2; "
-                      "qproperty-alignment: AlignCenter; }";
-        return {"Planned", style_sheet};
-    } else
-        return {"Null", ""};
-}
-
-void MainWindow::onDeleteCourseButtonClicked(QFrame *parent) {
-    QObject *semesterFrame = parent->parent();
-    QFrame *noCoursesFrame = semesterFrame->findChild<QFrame *>("noCoursesFrame");
-
-    if (noCoursesFrame &&
-        semesterFrame->findChildren<QFrame *>("courseFrame").size() == 1) {
-        noCoursesFrame->show();
+// Re-checks only the planned courses that depend on course, however long
+// the plan is
+void MainWindow::revalidateAffected(int course) {
+    if (!plan) {
+        return;
     }
-    if (parent) {
-        QSqlQuery query;
-        query.prepare(
-            "Delete from course_planning where course_code = :course_code");
-        query.bindValue(":course_code", parent->findChild<QLabel*>("titleLabel", Qt::FindChildrenRecursively)->text());
-        query.exec();
-        updateSemesterStatus(semesterFrame);
-        parent->deleteLater();
+    for (int dependent : plan->affectedBy(course)) {
+        markCourseCard(dependent);
     }
 }
 
-void MainWindow::onEditCourseButtonClicked(QFrame *courseFrame,
-                                           course course_label,
-                                           QString semester) {
-    QString course_code = courseFrame->findChild<QLabel *>("titleLabel")->text();
-    EditCourseDetails w(course_code, semester, this);
-    bool activated = w.exec();
-
-    if (activated) {
-        course new_updated_course = w.getUpdatedCourse();
-        course_label.updateText(new_updated_course);
+bool MainWindow::eventFilter(QObject *watched, QEvent *event) {
+    // Zoom the prerequisite graph around the cursor
+    if (watched == ui->graphicsView->viewport() && event->type() == QEvent::Wheel) {
+        QWheelEvent *wheel = static_cast<QWheelEvent *>(event);
+        qreal factor = std::pow(1.0015, wheel->angleDelta().y());
+        qreal scale = ui->graphicsView->transform().m11() * factor;
+        if (scale > 0.02 && scale < 4) {
+            ui->graphicsView->scale(factor, factor);
+        }
+        return true;
     }
-}
 
-bool MainWindow::eventFilter(QObject *watched, QEvent *event) {
-    // Cast the watched object to QFrame to check if it's a courseFrame
-    QFrame *courseFrame = qobject_cast<QFrame *>(watched);
-
-    // Check if the watched object is a courseFrame
-    if (courseFrame && courseFrame->objectName().contains("courseFrame")) {
-        if (event->type() == QEvent::Enter) {
-            // Find the edit and delete buttons within THIS specific courseFrame
-            QPushButton *editButton =
-                courseFrame->findChild<QPushButton *>("edit_button");
-            QPushButton *deleteButton =
-                courseFrame->findChild<QPushButton *>("delete_button");
-
-            if (editButton) {
-                editButton->show();
-            }
-            if (deleteButton) {
-                deleteButton->show();
-            }
-            return true;
-        } else if (event->type() == QEvent::Leave) {
-            // Find the edit and delete buttons within THIS specific courseFrame
-            QPushButton *editButton =
-                courseFrame->findChild<QPushButton *>("edit_button");
-            QPushButton *deleteButton =
-                courseFrame->findChild<QPushButton *>("delete_button");
-
-            if (editButton) {
-                editButton->hide();
-            }
-            if (deleteButton) {
-                deleteButton->hide();
-            }
-            return true;
+    // A click selects a course; a press that moves further than a drag
+    // pans the view instead and leaves the selection alone
+    if (watched == ui->graphicsView->viewport() && graphItem
+        && (event->type() == QEvent::MouseButtonPress || event->type() == QEvent::MouseButtonRelease)
+        && static_cast<QMouseEvent *>(event)->button() == Qt::LeftButton) {
+        QPoint pos = static_cast<QMouseEvent *>(event)->position().toPoint();
+        if (event->type() == QEvent::MouseButtonPress) {
+            graphPressPos = pos;
+        } else if ((pos - graphPressPos).manhattanLength() < QApplication::startDragDistance()) {
+            graphItem->toggleSelection(graphItem->mapFromScene(ui->graphicsView->mapToScene(pos)));
         }
     }
 
@@ -855,139 +680,143 @@ QObject *MainWindow::findParent(QObject *child, const QString &parent_name) {
     }
 }
 
-void MainWindow::updateSemesterStatus(QObject *semesterFrame,
-                                      QString semester) {
+// Status line and empty-semester placeholder, from the model's totals
+void MainWindow::updateSemesterStatus(const Semester &semester) {
+    QFrame *semesterFrame = semesterFrames.value(semester.ordinal());
+    if (!semesterFrame) {
+        return;
+    }
     QLabel *semesterStatus = semesterFrame->findChild<QLabel *>(
         "semesterStatus", Qt::FindChildrenRecursively);
+    PlanSnapshot::Totals totals = planModel->totals(semester);
+    semesterStatus->setText(QString::number(totals.credits) + " credits • " +
+                            QString::number(totals.courses) + " courses");
 
-    QSqlQuery query;
-    query.prepare("SELECT sum(course_credits) "
-                  "FROM course_planning INNER JOIN course on "
-                  "course_planning.course_code = course.course_code "
-                  "WHERE sem_code = :semester");
-    query.bindValue(":semester", semester);
-    query.exec();
-    QString credits = "0"; // Default to 0
-    if (query.next()) {
-        QVariant result = query.value(0);
-        if (!result.isNull()) {
-            credits = result.toString();
-        }
+    QFrame *noCoursesFrame = semesterFrame->findChild<QFrame *>("noCoursesFrame");
+    if (noCoursesFrame) {
+        noCoursesFrame->setVisible(totals.courses == 0);
     }
-
-    query.prepare("SELECT count(course_planning.course_code) "
-                  "FROM course_planning INNER JOIN course on "
-                  "course_planning.course_code = course.course_code "
-                  "WHERE sem_code = :semester");
-    query.bindValue(":semester", semester);
-    query.exec();
-    query.next();
-    QString n_of_courses = query.value(0).toString();
-    semesterStatus->setText("test");
-    semesterStatus->setText(credits + " credits • " + n_of_courses + " courses");
-}
-
-void MainWindow::updateSemesterStatus(QObject *semesterFrame) {
-    QLabel *semesterTitle = semesterFrame->findChild<QLabel *>(
-        "semesterTitle", Qt::FindChildrenRecursively);
-
-    updateSemesterStatus(semesterFrame, semesterTitle->text().remove(' '));
 }
 
 void MainWindow::onAddSemButtonClicked() {
     newSemester w(this);
     bool activated = w.exec();
-    QVBoxLayout *layout = this->findChild<QVBoxLayout *>("semesetersLayout");
-    int index_1;
-    int index_2;
 
-    if (activated) {
-        int semesters = layout->count() - 1;
-        QLabel* previous_sem = layout->itemAt(semesters - 1)->widget()->findChild<QLabel *>("semesterTitle");
-        QString semester;
-        if(previous_sem){
-            semester = previous_sem->text();
-        } else semester = layout->itemAt(semesters - 2)->widget()->findChild<QLabel *>("semesterTitle")->text();
-
-        int last_sem_year = std::stoi(extractYear(semester.toStdString()));
+    if (activated && !board->rows().isEmpty()) {
+        Semester last = board->rows().last().semesters.last();
         int semester_type = w.get_sem_type();
-        std::string season = extractSeason(semester.toStdString());
+        PlanBoard::Row row;
 
         if (semester_type == 0) {
-            if (season == "FALL") {
+            if (last.term() == Semester::Fall) {
                 // add SPRING and last_sem_year + 1
-                createSemesterFrame(last_sem_year + 1, "SPRING");
-                index_1 = layout->count() - 1;
-                index_2 = layout->count() - 2;
-                swapTwoItemsInLayout(layout, index_1, index_2);
+                row.semesters = {Semester(last.year() + 1, Semester::Spring)};
             } else {
                 // add FALL and last_sem_year
-                createSemesterFrame(last_sem_year, "FALL");
-                index_1 = layout->count() - 1;
-                index_2 = layout->count() - 2;
-                swapTwoItemsInLayout(layout, index_1, index_2);
+                row.semesters = {Semester(last.year(), Semester::Fall)};
             }
         } else {
-            if (season == "SPRING") {
+            if (last.term() == Semester::Spring) {
                 // add SUMMER and last_sem_year
-                createSemesterFrame(last_sem_year, "SUMMER");
-                index_1 = layout->count() - 1;
-                index_2 = layout->count() - 2;
-                swapTwoItemsInLayout(layout, index_1, index_2);
+                row.semesters = {Semester(last.year(), Semester::Summer)};
             } else {
                 // add SUMMER and last_sem_year + 1
-                createSemesterFrame(last_sem_year + 1, "SUMMER");
-                index_1 = layout->count() - 1;
-                index_2 = layout->count() - 2;
-                swapTwoItemsInLayout(layout, index_1, index_2);
+                row.semesters = {Semester(last.year() + 1, Semester::Summer)};
             }
         }
+        board->appendRow(row);
     }
 }
 
-// Swap positions of two items at index1 and index2
-void MainWindow::swapTwoItemsInLayout(QVBoxLayout *layout, int index_1,
-                                      int index_2) {
-    if (index_1 < 0 || index_2 < 0 || index_1 >= layout->count() ||
-        index_2 >= layout->count()) {
+void MainWindow::onAutoPlanButtonClicked() {
+    if (!requirements) {
+        QMessageBox::warning(this, "Plan remaining courses", "The major's requirements couldn't be read.");
+        return;
+    }
+    bool ok = false;
+    int cap = QInputDialog::getInt(this, "Plan remaining courses",
+                                   "Most credits per semester:", projectionSettings.creditCap,
+                                   3, 30, 1, &ok);
+    if (!ok) {
         return;
     }
 
-    QLayoutItem *item_1 = layout->takeAt(index_1);
-    QLayoutItem *item_2 = layout->takeAt(index_2 - (index_2 > index_1 ? 1 : 0));
-
-    layout->insertItem(index_2, item_1);
-    layout->insertItem(index_1, item_2);
-}
+    const PrerequisiteGraph &graph = PrerequisiteGraph::active();
+    DegreePlanner planner(*requirements);
+    planner.load(*plan);
+    planner.settings().creditCap = cap;
+    planner.settings().summers = projectionSettings.summers;
+
+    // The search runs on the thread pool; the dialog only waits for it
+    QProgressDialog progress("Looking for the shortest plan...", "Cancel", 0, 0, this);
+    progress.setWindowModality(Qt::WindowModal);
+    QFutureWatcher<bool> watcher;
+    connect(&watcher, &QFutureWatcher<bool>::finished, &progress, &QProgressDialog::reset);
+    connect(&progress, &QProgressDialog::canceled, this, [&planner]() { planner.cancel(); });
+    watcher.setFuture(QtConcurrent::run([&planner]() { return planner.run(); }));
+    progress.exec();
+    watcher.waitForFinished();
+
+    if (!watcher.result()) {
+        QMessageBox::warning(this, "Plan remaining courses", planner.errorString());
+        return;
+    }
+    QList<PlannedCourse> planned = planner.result();
+    if (QMessageBox::question(this, "Plan remaining courses",
+                              QString("Add %1 courses over %2 semesters to the plan?")
+                                  .arg(planned.size()).arg(planner.semesterCount())) != QMessageBox::Yes) {
+        return;
+    }
 
-std::string MainWindow::extractYear(const std::string &semester) {
-    // Assuming format: "SEASON YEAR"
-    return semester.substr(semester.find(' ') + 1);
-}
+    QSqlDatabase db = QSqlDatabase::database();
+    if (!db.transaction()) {
+        QMessageBox::critical(this, "Plan remaining courses", db.lastError().text());
+        return;
+    }
+    QSqlQuery query;
+    query.prepare(PlanQueries::insertPlannedCourse);
+    for (const PlannedCourse &course : planned) {
+        query.bindValue(":course_code", graph.courseCode(course.course));
+        query.bindValue(":sem_code", course.semester.code());
+        query.bindValue(":sem_ordinal", course.semester.ordinal());
+        query.bindValue(":is_current_course", 0);
+        query.bindValue(":is_planned_course", 1);
+        query.bindValue(":is_done_course", 0);
+        query.bindValue(":grade", "");
+        query.bindValue(":profile_id", profile_id);
+        if (!query.exec()) {
+            db.rollback();
+            QMessageBox::critical(this, "Plan remaining courses", query.lastError().text());
+            return;
+        }
+    }
+    if (!db.commit()) {
+        QMessageBox::critical(this, "Plan remaining courses", db.lastError().text());
+        db.rollback();
+        return;
+    }
+    ++plan_revision;
 
-std::string MainWindow::extractSeason(const std::string &semester) {
-    // Assuming format: "SEASON YEAR"
-    return semester.substr(0, semester.find(' '));
+    for (const PlannedCourse &course : planned) {
+        plan->place(course.course, course.semester);
+        addCoursesFromDatabase(graph.courseCode(course.course));
+    }
+    updateCounters();
 }
 
-void MainWindow::onAddSemButtonClicked(QHBoxLayout* layout, int year, QPushButton* button_src){
-    int index = layout->indexOf(button_src);
-    createSemesterFrame(layout , year+1, "SUMMER");
-    button_src->setStyleSheet("QPushButton{background-color: transparent}");
-    QLayoutItem *button = layout->takeAt(index);
-    layout->removeItem(button);
+void MainWindow::onAddSummerButtonClicked(int index){
+    PlanBoard::Row row = board->rows().value(index);
+    if (row.summerYear < 0) {
+        return;
+    }
+    row.semesters.append(Semester(row.summerYear + 1, Semester::Summer));
+    row.summerYear = -1;
+    board->setRow(index, row);
 }
 
 void MainWindow::updateCreditsEarned(){
-    QSqlQuery query;
     int credits_earned = getCreditsEarned();
-
-    query.prepare("select credit_requirements from profile inner join major on profile.major = major.major_name "
-                  "where id = :profile_id");
-    query.bindValue(":profile_id", profile_id);
-    query.exec();
-    query.next();
-    int credits_requirement = query.value(0).toInt();
+    int credits_requirement = requirements ? requirements->creditsRequired() : 0;
 
     ui->credits_earned_label->setText(QString::number(credits_earned) + "/" + QString::number(credits_requirement));
 
@@ -996,88 +825,53 @@ void MainWindow::updateCreditsEarned(){
     ui->credit_precentage_label->setText(QString::number(credits_progress) + "% complete");
 }
 
+// From the cards on the board, which always match the database
 int MainWindow::getCreditsEarned(){
-    QSqlQuery query;
-    query.exec("select sum(course_credits) "
-               "from course_planning cp inner JOIN course c on cp.course_code = c.course_code "
-               "where is_done_course = 1");
-    if(query.next()){
-        return query.value(0).toInt();
-    } else return 0;
+    int credits = 0;
+    for (const CourseCard &card : planModel->cards()) {
+        if (card.done) {
+            credits += card.credits;
+        }
+    }
+    return credits;
 }
 
+// The layout only depends on the catalog, so a plan change just repaints
 void MainWindow::populateGraphics(){
-    scene->addText("Hello, world!");
-    scene->addEllipse(1, 1, 1, 1);
-
-    ui->graphicsView->setScene(scene);
+    const PrerequisiteGraph &graph = PrerequisiteGraph::active();
+    if (!graphItem || graphItem->graphVersion() != graph.version()) {
+        scene->clear();
+        graphItem = new CourseGraphItem(graph);
+        scene->addItem(graphItem);
+        scene->setSceneRect(graphItem->boundingRect());
+    }
+    graphItem->setPlan(plan.get());
 }
 
+// Projected from what is completed, so it follows every edit of the plan
 void MainWindow::updateSemsLeft() {
-    // Get all profile data in one query
-    QSqlQuery query;
-    query.prepare(
-        "SELECT starting_semester, starting_year, graduation_year "
-        "FROM profile WHERE id = :profile_id"
-        );
-    query.bindValue(":profile_id", profile_id);
-    query.exec();
-    if (!query.next()) {
-        qDebug() << "Failed to get profile data:" << query.lastError().text();
+    if (!plan || !requirements) {
         return;
     }
+    GraduationProjection::Result projection =
+        GraduationProjection::project(*requirements, *plan, projectionSettings);
 
-    QString startingSemester = query.value("starting_semester").toString();
-    int startingYear = query.value("starting_year").toInt();
-    int endingYear = query.value("graduation_year").toInt();
-    QString endingSemester = "SPRING";  // Assuming graduation is always spring
-
-    ui->label_12->setText("Expected graduation: Spring " + QString::number(endingYear));
-
-    QString expectedSemsCountQuery = "SELECT count(sem_code) FROM semester "
-                                     "WHERE sem_code NOT LIKE '%SUMMER%' "
-                                     "AND ( (sem_year > :starting_year AND sem_year < :ending_year) "
-                                     "OR (sem_year = :starting_year AND CASE :starting_semester "
-                                     "WHEN 'FALL' THEN sem_term IN ('FALL') "
-                                     "WHEN 'SPRING' THEN sem_term IN ('SPRING', 'FALL') END) "
-                                     "OR (sem_year = :ending_year AND CASE :ending_semester "
-                                     "WHEN 'FALL' THEN sem_term IN ('SPRING', 'FALL') "
-                                     "WHEN 'SPRING' THEN sem_term IN ('SPRING') END) ) "
-                                     "ORDER BY sem_year, "
-                                     "CASE sem_term WHEN 'SPRING' THEN 1 WHEN 'FALL' THEN 2 END";
-
-    query.prepare(expectedSemsCountQuery);
-
-    query.bindValue(":starting_year", startingYear);
-    query.bindValue(":ending_year", endingYear);
-    query.bindValue(":starting_semester", startingSemester);
-    query.bindValue(":ending_semester", endingSemester);
-
-    query.exec();
-    query.next();
-    int expectedSemesterCount = query.value(0).toInt();
-
-    query.prepare("SELECT COUNT(*) FROM (SELECT sem_code FROM course_planning WHERE sem_code NOT LIKE '%SUMMER%' GROUP BY sem_code HAVING SUM(is_done_course) != 0)");
-    query.exec();
-    query.next();
-    int completedSemestersCount = query.value(0).toInt();
-
-    int num_of_sems_left = expectedSemesterCount - completedSemestersCount;
-    ui->num_sems_left->setText(QString::number(num_of_sems_left));
+    if (projection.graduation.isValid()) {
+        ui->label_12->setText("Earliest graduation: " + projection.graduation.title());
+    } else {
+        ui->label_12->setText("All requirements completed");
+    }
+    ui->num_sems_left->setText(QString::number(projection.terms));
 }
 
 void MainWindow::updateGPA() {
     int credits_earned = getCreditsEarned();
 
-    QSqlQuery query;
-    query.prepare("SELECT grade, c.course_credits "
-                  "FROM course_planning CP INNER JOIN course C on CP.course_code = c.course_code "
-                  "WHERE is_done_course = 1");
-    query.exec();
     float sum = 0;
-    while(query.next()){
-        float points = PointsFromGradeLetters(query.value(0).toString());
-        sum += points*query.value(1).toFloat();
+    for (const CourseCard &card : planModel->cards()) {
+        if (card.done) {
+            sum += PointsFromGradeLetters(card.grade)*card.credits;
+        }
     }
 
     float gpa = sum/static_cast<float>(credits_earned);
@@ -1129,4 +923,5 @@ float MainWindow::PointsFromGradeLetters(QString grade) {
 void MainWindow::on_tabWidget_tabBarClicked(int index)
 {
     if(index==0) refreshWindow();
+    if(index==2) populateGraphics();
 }
@@ -1,14 +1,25 @@
 #ifndef MAINWINDOW_H
 #define MAINWINDOW_H
 
-#include "course.h"
+#include "coursecard.h"
+#include "coursecarddelegate.h"
+#include "coursegraphitem.h"
+#include "courseplan.h"
+#include "degreerequirements.h"
+#include "graduationprojection.h"
+#include "planboard.h"
+#include "planmodel.h"
+#include "semester.h"
 #include "qboxlayout.h"
 #include "qframe.h"
 #include "qgraphicsscene.h"
 #include "qpushbutton.h"
+#include <QHash>
 #include <QMainWindow>
+#include <QPointer>
 #include <QtSql/QSqlDatabase>
 #include <QDebug>
+#include <memory>
 
 enum AcademicStanding {
     PROBATION,      // < 2.0
@@ -32,40 +43,59 @@ class MainWindow : public QMainWindow
 public:
     MainWindow(QWidget *parent = nullptr);
     ~MainWindow();
-    std::tuple<QString, QString> getCourseStatus(bool is_done, bool is_current, bool is_planned);
     void refreshWindow();
 
 private slots:   
     //void on_pushButton_clicked();
-    bool onAddCourseButtonClicked(QFrame *frame, QLayout *sourceLayout, QString semester);
-    void onFirstAddCourseButtonClicked(QFrame *frame, QLayout *sourceLayout, QFrame *noCoursesFrame, QString semester);
-    void onDeleteCourseButtonClicked(QFrame *parent);
-    void onEditCourseButtonClicked(QFrame* source, course course_label, QString semester);
+    bool onAddCourseButtonClicked(Semester semester);
+    void onDeleteCourseButtonClicked(const QString &course_code);
+    void onEditCourseButtonClicked(const QString &course_code);
     void onAddSemButtonClicked();
-    void onAddSemButtonClicked(QHBoxLayout* layout,int year, QPushButton* button);
+    void onAddSummerButtonClicked(int index);
+    void onAutoPlanButtonClicked();
 
     void on_tabWidget_tabBarClicked(int index);
 
 private:
-    course course_labels_temp;
     Ui::MainWindow *ui;
     QGraphicsScene *scene;
+    // The plan as shown, kept in step with every add, edit and delete so a
+    // change only re-checks the cards it can affect
+    std::unique_ptr<CoursePlan> plan;
+    std::unique_ptr<DegreeRequirements> requirements;
+    GraduationProjection::Settings projectionSettings;
+    // The cards on the board; semester frames only show their part of it
+    PlanModel *planModel;
+    CourseCardDelegate *cardDelegate;
+    QHash<int, QPointer<QFrame>> semesterFrames;  // by Semester::ordinal(), on screen only
+    PlanBoard *board = nullptr;
+    // What the window was last brought up to date with; see refreshWindow
+    int shownProfile = -1;
+    int shownGraphVersion = -1;
+    int shownRevision = -1;
+    // Owned by scene; rebuilt only when the catalog's graph changes
+    CourseGraphItem *graphItem = nullptr;
+    QPoint graphPressPos;  // viewport position of the last left press
 
     void populateSemesters();
+    void patchSemesters();
+    void updateCounters();
     void populateGraphics();
 
-    void createYearFrame(int year, QString starting_semester);
-    void createSemesterFrame(int year, QString semester);
-    void createSemesterFrame(QHBoxLayout* yearFrame, int year, QString semester);
-    void addCoursesFromDatabase(QFrame *frame, QLayout *sourceLayout, QString course_code);
-    void addAddSummerButton(QHBoxLayout* layout, int year);
+    void setupBoard();
+    QVector<PlanBoard::Row> yearRows(const PlanSnapshot& snapshot);
+    PlanBoard::Row yearRow(int year, QString starting_semester);
+    QWidget* createYearFrame(QWidget* parent);
+    void bindYearFrame(QWidget* row, int index, const PlanBoard::Row& data);
+    int estimateYearFrame(const PlanBoard::Row& data);
+    QFrame* createSemesterFrame();
+    void bindSemesterFrame(QFrame* frame, const Semester& key);
+    void addCoursesFromDatabase(QString course_code);
+    void addAddSummerButton(QHBoxLayout* layout);
     QObject* findParent(QObject* child, const QString& parent_name);
-    void updateSemesterStatus(QObject *semesterFrame, QString semester);
-    void updateSemesterStatus(QObject *semesterFrame);
-
-    std::string extractYear(const std::string& semester);
-    std::string extractSeason(const std::string& semester);
-    void swapTwoItemsInLayout(QVBoxLayout* layout, int index_1, int index_2);
+    void updateSemesterStatus(const Semester &semester);
+    void markCourseCard(int course);
+    void revalidateAffected(int course);
 
     void updateGPA();
     AcademicStanding getStandingFromGPA(double gpa);
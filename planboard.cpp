@@ -0,0 +1,164 @@
+#include "planboard.h"
+#include <QEvent>
+#include <QLayout>
+#include <QScrollBar>
+
+PlanBoard::PlanBoard(QScrollArea* area, RowFactory create, RowBinder bind, RowEstimate estimate)
+    : QWidget(area)
+    , area_(area)
+    , create_(std::move(create))
+    , bind_(std::move(bind))
+    , estimate_(std::move(estimate))
+{
+    area_->setWidget(this);
+    area_->setWidgetResizable(true);
+    area_->viewport()->installEventFilter(this);
+    connect(area_->verticalScrollBar(), &QScrollBar::valueChanged, this, [this]() { updateVisible(); });
+}
+
+void PlanBoard::setRows(const QVector<Row>& rows) {
+    for (auto it = live_.cbegin(); it != live_.cend(); ++it) {
+        it.value()->hide();
+        pool_.append(it.value());
+    }
+    live_.clear();
+
+    rows_ = rows;
+    heights_.clear();
+    measured_.fill(false, rows_.size());
+    for (const Row& row : rows_) {
+        heights_.append(estimate_(row));
+    }
+    updateVisible();
+}
+
+void PlanBoard::appendRow(const Row& row) {
+    rows_.append(row);
+    heights_.append(estimate_(row));
+    measured_.append(false);
+    updateVisible();
+}
+
+void PlanBoard::setRow(int index, const Row& row) {
+    if (index < 0 || index >= rows_.size()) {
+        return;
+    }
+    rows_[index] = row;
+    if (QWidget* widget = live_.value(index)) {
+        bind_(widget, index, row);
+    }
+    refreshRow(index);
+}
+
+int PlanBoard::rowOf(const Semester& semester) const {
+    for (int index = 0; index < rows_.size(); ++index) {
+        if (rows_[index].semesters.contains(semester)) {
+            return index;
+        }
+    }
+    return -1;
+}
+
+void PlanBoard::refreshRow(int index) {
+    if (index < 0 || index >= rows_.size()) {
+        return;
+    }
+    QWidget* widget = live_.value(index);
+    if (widget) {
+        heights_[index] = measure(index, widget);
+    } else {
+        heights_[index] = estimate_(rows_[index]);
+        measured_[index] = false;
+    }
+    updateVisible();
+}
+
+void PlanBoard::setFooter(QWidget* footer) {
+    footer_ = footer;
+    footer_->setParent(this);
+    footer_->show();
+    updateVisible();
+}
+
+bool PlanBoard::eventFilter(QObject* watched, QEvent* event) {
+    if (watched == area_->viewport() && event->type() == QEvent::Resize) {
+        updateVisible();
+    }
+    return QWidget::eventFilter(watched, event);
+}
+
+void PlanBoard::resizeEvent(QResizeEvent* event) {
+    QWidget::resizeEvent(event);
+    updateVisible();
+}
+
+QWidget* PlanBoard::take(int index) {
+    QWidget* widget = pool_.isEmpty() ? create_(this) : pool_.takeLast();
+    bind_(widget, index, rows_[index]);
+    widget->show();
+    live_.insert(index, widget);
+    return widget;
+}
+
+int PlanBoard::measure(int index, QWidget* widget) {
+    if (widget->layout()) {
+        widget->layout()->activate();
+    }
+    measured_[index] = true;
+    return widget->sizeHint().height();
+}
+
+void PlanBoard::updateVisible() {
+    const int top = area_->verticalScrollBar()->value();
+    const int overscan = area_->viewport()->height() / 2;
+    const int from = top - overscan;
+    const int to = top + area_->viewport()->height() + overscan;
+
+    // Measuring a row can move every row under it, so settle positions
+    // before deciding what is visible. A handful of passes is plenty: each
+    // one only measures rows that weren't measured before.
+    QVector<int> offsets(rows_.size() + 1, 0);
+    for (int pass = 0; pass < 4; ++pass) {
+        for (int index = 0; index < rows_.size(); ++index) {
+            offsets[index + 1] = offsets[index] + heights_[index];
+        }
+        bool changed = false;
+        for (int index = 0; index < rows_.size(); ++index) {
+            bool visible = offsets[index + 1] > from && offsets[index] < to;
+            QWidget* widget = live_.value(index);
+            if (!visible && widget) {
+                widget->hide();
+                pool_.append(widget);
+                live_.remove(index);
+            } else if (visible && !widget) {
+                widget = take(index);
+            }
+            if (visible && !measured_[index]) {
+                int height = measure(index, widget);
+                changed = changed || height != heights_[index];
+                heights_[index] = height;
+            }
+        }
+        if (!changed) {
+            break;
+        }
+    }
+    for (int index = 0; index < rows_.size(); ++index) {
+        offsets[index + 1] = offsets[index] + heights_[index];
+    }
+
+    int minimumWidth = 0;
+    for (auto it = live_.cbegin(); it != live_.cend(); ++it) {
+        it.value()->setGeometry(0, offsets[it.key()], width(), heights_[it.key()]);
+        minimumWidth = qMax(minimumWidth, it.value()->minimumSizeHint().width());
+    }
+    int total = offsets[rows_.size()];
+    if (footer_) {
+        int height = footer_->sizeHint().height();
+        footer_->setGeometry(0, total, width(), height);
+        total += height;
+    }
+    if (minimumHeight() != total || this->minimumWidth() < minimumWidth) {
+        setMinimumSize(qMax(this->minimumWidth(), minimumWidth), total);
+    }
+}
@@ -0,0 +1,75 @@
+#ifndef PLANBOARD_H
+#define PLANBOARD_H
+
+#include "semester.h"
+
+#include <QHash>
+#include <QScrollArea>
+#include <QVector>
+#include <QWidget>
+#include <functional>
+
+// The course planner's scrolling content. The board holds one row per
+// year of the plan but only keeps widgets for the rows that intersect the
+// viewport, plus half a viewport of overscan either way. A row that scrolls
+// out is hidden and rebound to the next row that scrolls in, so the widget
+// count follows the window height rather than the length of the plan.
+//
+// Rows it hasn't measured are placed at an estimated height. Binding a
+// row measures it and shifts the rows below if the estimate was off.
+class PlanBoard : public QWidget
+{
+    Q_OBJECT
+
+public:
+    struct Row {
+        QVector<Semester> semesters;
+        int summerYear = -1;  // year whose "add summer" button shows, -1 for none
+
+        bool operator==(const Row& other) const {
+            return semesters == other.semesters && summerYear == other.summerYear;
+        }
+        bool operator!=(const Row& other) const { return !(*this == other); }
+    };
+
+    using RowFactory = std::function<QWidget*(QWidget* parent)>;
+    using RowBinder = std::function<void(QWidget* widget, int index, const Row& row)>;
+    using RowEstimate = std::function<int(const Row& row)>;
+
+    PlanBoard(QScrollArea* area, RowFactory create, RowBinder bind, RowEstimate estimate);
+
+    const QVector<Row>& rows() const { return rows_; }
+    void setRows(const QVector<Row>& rows);
+    void appendRow(const Row& row);
+    void setRow(int index, const Row& row);
+    // -1 when no row shows the semester
+    int rowOf(const Semester& semester) const;
+    // Re-measures the row after its content changed
+    void refreshRow(int index);
+
+    // Stays below the last row, always materialized
+    void setFooter(QWidget* footer);
+
+protected:
+    bool eventFilter(QObject* watched, QEvent* event) override;
+    void resizeEvent(QResizeEvent* event) override;
+
+private:
+    QScrollArea* area_;
+    RowFactory create_;
+    RowBinder bind_;
+    RowEstimate estimate_;
+
+    QVector<Row> rows_;
+    QVector<int> heights_;
+    QVector<bool> measured_;
+    QHash<int, QWidget*> live_;  // row index -> widget
+    QVector<QWidget*> pool_;
+    QWidget* footer_ = nullptr;
+
+    QWidget* take(int index);
+    int measure(int index, QWidget* widget);
+    void updateVisible();
+};
+
+#endif // PLANBOARD_H
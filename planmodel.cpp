@@ -0,0 +1,245 @@
+#include "planmodel.h"
+#include <algorithm>
+
+PlanModel::PlanModel(QObject* parent)
+    : QAbstractItemModel(parent)
+{
+}
+
+void PlanModel::load(const PlanSnapshot& snapshot) {
+    beginResetModel();
+    semesters_.clear();
+    ordinalOf_.clear();
+    for (int ordinal : snapshot.ordinals()) {
+        Semester semester = Semester::fromOrdinal(ordinal);
+        SemesterRow row{ordinal, {}, snapshot.totals(semester)};
+        for (const CourseCard& card : snapshot.cards(semester)) {
+            row.entries.append({card, {}});
+            ordinalOf_.insert(card.code, ordinal);
+        }
+        semesters_.append(row);
+    }
+    endResetModel();
+}
+
+int PlanModel::insertionRow(int ordinal) const {
+    auto it = std::lower_bound(semesters_.cbegin(), semesters_.cend(), ordinal,
+                               [](const SemesterRow& row, int value) { return row.ordinal < value; });
+    return int(it - semesters_.cbegin());
+}
+
+int PlanModel::semesterRow(int ordinal) const {
+    int row = insertionRow(ordinal);
+    return row < semesters_.size() && semesters_[row].ordinal == ordinal ? row : -1;
+}
+
+int PlanModel::entryRow(const SemesterRow& semester, const QString& courseCode) const {
+    for (int row = 0; row < semester.entries.size(); ++row) {
+        if (semester.entries[row].card.code == courseCode) {
+            return row;
+        }
+    }
+    return -1;
+}
+
+QModelIndex PlanModel::semesterIndex(const Semester& semester) const {
+    int row = semesterRow(semester.ordinal());
+    return row < 0 ? QModelIndex() : createIndex(row, 0, quintptr(0));
+}
+
+QModelIndex PlanModel::addSemester(const Semester& semester) {
+    QModelIndex existing = semesterIndex(semester);
+    if (existing.isValid()) {
+        return existing;
+    }
+    int row = insertionRow(semester.ordinal());
+    beginInsertRows(QModelIndex(), row, row);
+    semesters_.insert(row, SemesterRow{semester.ordinal(), {}, {}});
+    endInsertRows();
+    return createIndex(row, 0, quintptr(0));
+}
+
+QModelIndex PlanModel::cardIndex(const QString& courseCode) const {
+    auto ordinal = ordinalOf_.constFind(courseCode);
+    if (ordinal == ordinalOf_.cend()) {
+        return QModelIndex();
+    }
+    int row = semesterRow(*ordinal);
+    int entry = row < 0 ? -1 : entryRow(semesters_[row], courseCode);
+    return entry < 0 ? QModelIndex() : createIndex(entry, 0, quintptr(*ordinal + 1));
+}
+
+const PlanModel::Entry* PlanModel::entry(const QModelIndex& index) const {
+    if (!index.isValid() || index.internalId() == 0) {
+        return nullptr;
+    }
+    int row = semesterRow(int(index.internalId()) - 1);
+    if (row < 0 || index.row() >= semesters_[row].entries.size()) {
+        return nullptr;
+    }
+    return &semesters_[row].entries[index.row()];
+}
+
+CourseCard PlanModel::card(const QModelIndex& index) const {
+    const Entry* found = entry(index);
+    return found ? found->card : CourseCard();
+}
+
+QList<CourseCard> PlanModel::cards() const {
+    QList<CourseCard> result;
+    result.reserve(ordinalOf_.size());
+    for (const SemesterRow& semester : semesters_) {
+        for (const Entry& entry : semester.entries) {
+            result.append(entry.card);
+        }
+    }
+    return result;
+}
+
+void PlanModel::addCard(const CourseCard& card) {
+    removeCard(card.code);
+    QModelIndex parent = addSemester(Semester::fromOrdinal(card.semOrdinal));
+    SemesterRow& semester = semesters_[parent.row()];
+    int row = int(semester.entries.size());
+    beginInsertRows(parent, row, row);
+    semester.entries.append({card, {}});
+    semester.totals.credits += card.credits;
+    ++semester.totals.courses;
+    ordinalOf_.insert(card.code, card.semOrdinal);
+    endInsertRows();
+    emit dataChanged(parent, parent);
+}
+
+void PlanModel::removeCard(const QString& courseCode) {
+    QModelIndex index = cardIndex(courseCode);
+    if (!index.isValid()) {
+        return;
+    }
+    QModelIndex parent = index.parent();
+    SemesterRow& semester = semesters_[parent.row()];
+    beginRemoveRows(parent, index.row(), index.row());
+    semester.totals.credits -= semester.entries[index.row()].card.credits;
+    --semester.totals.courses;
+    semester.entries.removeAt(index.row());
+    ordinalOf_.remove(courseCode);
+    endRemoveRows();
+    emit dataChanged(parent, parent);
+}
+
+void PlanModel::replaceCard(const QString& courseCode, const CourseCard& card) {
+    QModelIndex index = cardIndex(courseCode);
+    if (!index.isValid() || semesters_[index.parent().row()].ordinal != card.semOrdinal) {
+        removeCard(courseCode);
+        addCard(card);
+        return;
+    }
+    if (courseCode != card.code) {
+        removeCard(card.code);
+        index = cardIndex(courseCode);
+    }
+    QModelIndex parent = index.parent();
+    SemesterRow& semester = semesters_[parent.row()];
+    Entry& entry = semester.entries[index.row()];
+    semester.totals.credits += card.credits - entry.card.credits;
+    entry = {card, {}};
+    ordinalOf_.remove(courseCode);
+    ordinalOf_.insert(card.code, card.semOrdinal);
+    emit dataChanged(index, index);
+    emit dataChanged(parent, parent);
+}
+
+void PlanModel::setViolations(const QString& courseCode, const QStringList& messages) {
+    QModelIndex index = cardIndex(courseCode);
+    if (!index.isValid()) {
+        return;
+    }
+    Entry& entry = semesters_[index.parent().row()].entries[index.row()];
+    if (entry.violations != messages) {
+        entry.violations = messages;
+        emit dataChanged(index, index, {ViolationsRole, Qt::ToolTipRole});
+    }
+}
+
+PlanSnapshot::Totals PlanModel::totals(const Semester& semester) const {
+    int row = semesterRow(semester.ordinal());
+    return row < 0 ? PlanSnapshot::Totals() : semesters_[row].totals;
+}
+
+int PlanModel::cardCount(const Semester& semester) const {
+    int row = semesterRow(semester.ordinal());
+    return row < 0 ? 0 : int(semesters_[row].entries.size());
+}
+
+QModelIndex PlanModel::index(int row, int column, const QModelIndex& parent) const {
+    if (column != 0 || row < 0) {
+        return QModelIndex();
+    }
+    if (!parent.isValid()) {
+        return row < semesters_.size() ? createIndex(row, 0, quintptr(0)) : QModelIndex();
+    }
+    if (parent.internalId() != 0 || parent.row() >= semesters_.size()) {
+        return QModelIndex();
+    }
+    const SemesterRow& semester = semesters_[parent.row()];
+    return row < semester.entries.size() ? createIndex(row, 0, quintptr(semester.ordinal + 1))
+                                         : QModelIndex();
+}
+
+QModelIndex PlanModel::parent(const QModelIndex& child) const {
+    if (!child.isValid() || child.internalId() == 0) {
+        return QModelIndex();
+    }
+    int row = semesterRow(int(child.internalId()) - 1);
+    return row < 0 ? QModelIndex() : createIndex(row, 0, quintptr(0));
+}
+
+int PlanModel::rowCount(const QModelIndex& parent) const {
+    if (!parent.isValid()) {
+        return int(semesters_.size());
+    }
+    if (parent.internalId() != 0 || parent.row() >= semesters_.size()) {
+        return 0;
+    }
+    return int(semesters_[parent.row()].entries.size());
+}
+
+int PlanModel::columnCount(const QModelIndex&) const {
+    return 1;
+}
+
+QVariant PlanModel::data(const QModelIndex& index, int role) const {
+    if (!index.isValid()) {
+        return QVariant();
+    }
+    if (index.internalId() == 0) {
+        if (index.row() >= semesters_.size()) {
+            return QVariant();
+        }
+        const SemesterRow& semester = semesters_[index.row()];
+        switch (role) {
+        case Qt::DisplayRole:
+            return Semester::fromOrdinal(semester.ordinal).title();
+        case OrdinalRole:
+            return semester.ordinal;
+        default:
+            return QVariant();
+        }
+    }
+
+    const Entry* found = entry(index);
+    if (!found) {
+        return QVariant();
+    }
+    switch (role) {
+    case Qt::DisplayRole:
+        return found->card.code;
+    case Qt::ToolTipRole:
+        return found->violations.isEmpty() ? QVariant() : QVariant(found->violations.join("\n"));
+    case CardRole:
+        return QVariant::fromValue(found->card);
+    case ViolationsRole:
+        return found->violations;
+    default:
+        return QVariant();
+    }
+}
@@ -0,0 +1,77 @@
+#ifndef PLANMODEL_H
+#define PLANMODEL_H
+
+#include "coursecard.h"
+#include "plansnapshot.h"
+#include "semester.h"
+
+#include <QAbstractItemModel>
+#include <QStringList>
+#include <QVector>
+
+// The plan board's data: semesters in order as top-level rows, each with
+// its course cards as children. Every view of the board reads from here, so
+// a card is one CourseCard value rather than a dozen widgets, and adding,
+// editing or removing a course only touches its own row.
+//
+// A child index keeps its semester's ordinal + 1 as internalId, which stays
+// valid when semesters are inserted ahead of it.
+class PlanModel : public QAbstractItemModel
+{
+    Q_OBJECT
+
+public:
+    enum Roles {
+        CardRole = Qt::UserRole + 1,  // CourseCard
+        ViolationsRole,               // QStringList, empty when the card is fine
+        OrdinalRole,                  // Semester::ordinal() of a semester row
+    };
+
+    explicit PlanModel(QObject* parent = nullptr);
+
+    void load(const PlanSnapshot& snapshot);
+
+    // Invalid when the semester has no row yet
+    QModelIndex semesterIndex(const Semester& semester) const;
+    // Adds an empty row for the semester when it has none
+    QModelIndex addSemester(const Semester& semester);
+    QModelIndex cardIndex(const QString& courseCode) const;
+    CourseCard card(const QModelIndex& index) const;
+    // Every card, semester by semester
+    QList<CourseCard> cards() const;
+
+    void addCard(const CourseCard& card);
+    void removeCard(const QString& courseCode);
+    // Keeps the card's place in its semester
+    void replaceCard(const QString& courseCode, const CourseCard& card);
+    void setViolations(const QString& courseCode, const QStringList& messages);
+
+    PlanSnapshot::Totals totals(const Semester& semester) const;
+    int cardCount(const Semester& semester) const;
+
+    QModelIndex index(int row, int column, const QModelIndex& parent = QModelIndex()) const override;
+    QModelIndex parent(const QModelIndex& child) const override;
+    int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+    int columnCount(const QModelIndex& parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
+
+private:
+    struct Entry {
+        CourseCard card;
+        QStringList violations;
+    };
+    struct SemesterRow {
+        int ordinal;
+        QVector<Entry> entries;
+        PlanSnapshot::Totals totals;
+    };
+    QVector<SemesterRow> semesters_;  // by ordinal
+    QHash<QString, int> ordinalOf_;   // course code -> semester ordinal
+
+    int semesterRow(int ordinal) const;  // -1 when missing
+    int insertionRow(int ordinal) const;
+    int entryRow(const SemesterRow& semester, const QString& courseCode) const;
+    const Entry* entry(const QModelIndex& index) const;
+};
+
+#endif // PLANMODEL_H
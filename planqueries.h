@@ -0,0 +1,109 @@
+#ifndef PLANQUERIES_H
+#define PLANQUERIES_H
+
+// SQL the application runs against a profile's plan and the catalog. Kept
+// in one place so DatabaseInitializer::checkQueryPlans() runs
+// EXPLAIN QUERY PLAN over exactly what the windows and the in-memory
+// models execute.
+//
+// Catalog tables are deliberately left unqualified: they resolve to the one
+// institution catalog InstitutionCatalog has attached.
+namespace PlanQueries {
+
+inline constexpr const char* planProfile =
+    "SELECT starting_year, starting_semester, graduation_year FROM profile "
+    "WHERE id = :profile_id";
+
+// Every card of a profile's plan; see CourseCard
+inline constexpr const char* planCards =
+    "SELECT cp.course_code, cp.sem_ordinal, cp.is_current_course, "
+    "cp.is_planned_course, cp.is_done_course, cp.grade, "
+    "c.course_title, c.course_credits, c.course_level "
+    "FROM course_planning cp LEFT JOIN course c ON cp.course_key = c.course_key "
+    "WHERE cp.profile_id = :profile_id "
+    "ORDER BY cp.sem_ordinal, cp.course_key";
+
+inline constexpr const char* courseCard =
+    "SELECT cp.course_code, cp.sem_ordinal, cp.is_current_course, "
+    "cp.is_planned_course, cp.is_done_course, cp.grade, "
+    "c.course_title, c.course_credits, c.course_level "
+    "FROM course_planning cp LEFT JOIN course c ON cp.course_key = c.course_key "
+    "WHERE cp.course_code = :course_code";
+
+// CoursePlan::load
+inline constexpr const char* planCourses =
+    "SELECT course_code, sem_ordinal, is_done_course FROM course_planning "
+    "WHERE profile_id = :profile_id";
+
+// DegreeRequirements::load
+inline constexpr const char* profileRequirements =
+    "SELECT p.starting_semester, p.starting_year, p.graduation_year, "
+    "m.credit_requirements, m.department_id "
+    "FROM profile p INNER JOIN major m ON p.major = m.major_name "
+    "WHERE p.id = :profile_id";
+
+inline constexpr const char* courseSummary =
+    "SELECT course_title, course_credits FROM course WHERE course_code = :course";
+
+inline constexpr const char* courseStatus =
+    "SELECT is_current_course, is_planned_course, is_done_course, grade FROM course_planning "
+    "WHERE course_code = :course";
+
+inline constexpr const char* insertPlannedCourse =
+    "INSERT INTO course_planning (course_code, course_key, sem_code, sem_ordinal, "
+    "is_current_course, is_planned_course, is_done_course, grade, profile_id) "
+    "VALUES (:course_code, (SELECT course_key FROM course WHERE course_code = :course_code), "
+    ":sem_code, :sem_ordinal, :is_current_course, :is_planned_course, :is_done_course, "
+    ":grade, :profile_id)";
+
+inline constexpr const char* updatePlannedCourse =
+    "UPDATE course_planning SET course_code = :new_course_code, "
+    "course_key = (SELECT course_key FROM course WHERE course_code = :new_course_code), "
+    "is_current_course = :is_current_course, is_done_course = :is_done_course, "
+    "is_planned_course = :is_planned_course, grade = :grade "
+    "WHERE course_code = :old_course_code";
+
+inline constexpr const char* deletePlannedCourse =
+    "DELETE FROM course_planning WHERE course_code = :course_code";
+
+// Must use an index: each runs once per card, dialog or edit
+inline constexpr const char* all[] = {
+    planProfile, planCards, courseCard, planCourses, profileRequirements,
+    courseSummary, courseStatus, insertPlannedCourse, updatePlannedCourse,
+    deletePlannedCourse,
+};
+
+// Course pickers: every course not planned yet, or not planned besides
+// the one being edited
+inline constexpr const char* unplannedCourses =
+    "SELECT course_code FROM course "
+    "WHERE course_code NOT IN (SELECT cp.course_code FROM course_planning cp)";
+
+inline constexpr const char* replacementCourses =
+    "SELECT course_code FROM course "
+    "WHERE course_code NOT IN (SELECT cp.course_code FROM course_planning cp "
+    "WHERE cp.course_code != :course_code)";
+
+inline constexpr const char* majorNames = "SELECT major_name FROM major";
+
+// PrerequisiteGraph::load
+inline constexpr const char* graphCourses = "SELECT course_code FROM course ORDER BY course_key";
+
+inline constexpr const char* graphPrerequisites =
+    "SELECT course_code, prereq, prereq_is_corequisite FROM course_prereq";
+
+// DegreeRequirements::load
+inline constexpr const char* requirementCourses =
+    "SELECT course_code, course_credits, dep_code, course_type FROM course";
+
+// Read a whole catalog table by design, once per window or catalog load.
+// Still explained, so a query that no longer matches the schema fails the
+// check, but a table scan is expected.
+inline constexpr const char* fullReads[] = {
+    unplannedCourses, replacementCourses, majorNames,
+    graphCourses, graphPrerequisites, requirementCourses,
+};
+
+} // namespace PlanQueries
+
+#endif // PLANQUERIES_H
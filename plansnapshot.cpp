@@ -0,0 +1,41 @@
+#include "plansnapshot.h"
+#include "planqueries.h"
+#include <QSqlQuery>
+#include <QSqlError>
+#include <QDebug>
+#include <algorithm>
+
+bool PlanSnapshot::load(int profileId) {
+    cards_.clear();
+    totals_.clear();
+
+    QSqlQuery query;
+    query.setForwardOnly(true);
+    query.prepare(PlanQueries::planProfile);
+    query.bindValue(":profile_id", profileId);
+    if (!query.exec() || !query.next()) {
+        qDebug() << "Failed to read profile" << profileId << ":" << query.lastError().text();
+        return false;
+    }
+    startingYear_ = query.value("starting_year").toInt();
+    startingSemester_ = query.value("starting_semester").toString();
+    graduationYear_ = query.value("graduation_year").toInt();
+
+    if (!CourseCard::loadPlan(profileId, cards_)) {
+        return false;
+    }
+    for (auto it = cards_.cbegin(); it != cards_.cend(); ++it) {
+        Totals& totals = totals_[it.key()];
+        for (const CourseCard& card : it.value()) {
+            totals.credits += card.credits;
+            ++totals.courses;
+        }
+    }
+    return true;
+}
+
+QList<int> PlanSnapshot::ordinals() const {
+    QList<int> ordinals = cards_.keys();
+    std::sort(ordinals.begin(), ordinals.end());
+    return ordinals;
+}
@@ -0,0 +1,43 @@
+#ifndef PLANSNAPSHOT_H
+#define PLANSNAPSHOT_H
+
+#include "coursecard.h"
+#include "semester.h"
+
+#include <QHash>
+#include <QList>
+#include <QString>
+
+// Everything MainWindow needs to lay out a profile's plan, read up front:
+// the profile's years, every course card by semester and each semester's
+// totals. Two queries however many years the plan spans, so building the
+// window never goes back to the database per year or per semester.
+class PlanSnapshot
+{
+public:
+    struct Totals {
+        int credits = 0;
+        int courses = 0;
+    };
+
+    bool load(int profileId);
+
+    int startingYear() const { return startingYear_; }
+    QString startingSemester() const { return startingSemester_; }
+    int graduationYear() const { return graduationYear_; }
+
+    // Semesters with planned courses, in order
+    QList<int> ordinals() const;
+    bool hasCourses(const Semester& semester) const { return cards_.contains(semester.ordinal()); }
+    QList<CourseCard> cards(const Semester& semester) const { return cards_.value(semester.ordinal()); }
+    Totals totals(const Semester& semester) const { return totals_.value(semester.ordinal()); }
+
+private:
+    int startingYear_ = 0;
+    QString startingSemester_;
+    int graduationYear_ = 0;
+    QHash<int, QList<CourseCard>> cards_;
+    QHash<int, Totals> totals_;
+};
+
+#endif // PLANSNAPSHOT_H
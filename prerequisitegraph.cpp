@@ -0,0 +1,312 @@
+#include "prerequisitegraph.h"
+#include "planqueries.h"
+#include <QSqlQuery>
+#include <QSqlError>
+#include <QDebug>
+#include <QElapsedTimer>
+#include <algorithm>
+#include <memory>
+
+static std::unique_ptr<PrerequisiteGraph> activeGraph;
+static int lastVersion = 0;
+
+const PrerequisiteGraph& PrerequisiteGraph::active() {
+    if (!activeGraph) {
+        activeGraph.reset(new PrerequisiteGraph);
+        QSqlDatabase db = QSqlDatabase::database();
+        // An empty graph lets every course through, which is what the
+        // trigger did when course_prereq had no rows for it
+        if (!activeGraph->load(db)) {
+            qDebug() << "Prerequisite checks are disabled";
+        }
+    }
+    return *activeGraph;
+}
+
+void PrerequisiteGraph::invalidate() {
+    activeGraph.reset();
+}
+
+void PrerequisiteGraph::refresh() {
+    if (activeGraph) {
+        QSqlDatabase db = QSqlDatabase::database();
+        if (!activeGraph->load(db)) {
+            qDebug() << "Prerequisite checks are disabled";
+        }
+    }
+}
+
+void PrerequisiteGraph::clear() {
+    codes_.clear();
+    ids_.clear();
+    prereqOffsets_.clear();
+    prereqs_.clear();
+    prereqMasks_.clear();
+    coreqMasks_.clear();
+    dependentOffsets_.clear();
+    dependents_.clear();
+    ancestors_.clear();
+    unlocks_.clear();
+    order_.clear();
+    levels_.clear();
+    depths_.clear();
+    cycles_.clear();
+}
+
+bool PrerequisiteGraph::load(QSqlDatabase& db) {
+    QElapsedTimer timer;
+    timer.start();
+    version_ = ++lastVersion;
+
+    QSqlQuery query(db);
+    query.setForwardOnly(true);
+    if (!query.exec(PlanQueries::graphCourses)) {
+        qDebug() << "Failed to load courses:" << query.lastError().text();
+        clear();
+        return false;
+    }
+    QVector<QString> codes;
+    QHash<QString, int> ids;
+    while (query.next()) {
+        ids.insert(query.value(0).toString(), int(codes.size()));
+        codes.append(query.value(0).toString());
+    }
+
+    if (!query.exec(PlanQueries::graphPrerequisites)) {
+        qDebug() << "Failed to load prerequisites:" << query.lastError().text();
+        clear();
+        return false;
+    }
+    QVector<Edge> edges;
+    while (query.next()) {
+        int course = ids.value(query.value(0).toString(), -1);
+        int prereq = ids.value(query.value(1).toString(), -1);
+        if (course < 0 || prereq < 0) {
+            qDebug() << "Skipping prerequisite" << query.value(1).toString()
+                     << "of" << query.value(0).toString() << ": unknown course";
+            continue;
+        }
+        edges.append({course, prereq, query.value(2).toBool()});
+    }
+
+    // The closure of an unchanged course list only needs patching
+    QVector<CourseSet> oldPrereqs;
+    QVector<CourseSet> oldCoreqs;
+    bool sameCourses = !codes_.isEmpty() && codes == codes_;
+    if (sameCourses) {
+        oldPrereqs.swap(prereqMasks_);
+        oldCoreqs.swap(coreqMasks_);
+    } else {
+        clear();
+        codes_ = codes;
+        ids_ = ids;
+    }
+
+    // A cycle would make every course on it, and every course after it,
+    // impossible to plan. Report each one and drop the prerequisite that
+    // closes it, like an unknown course, so the rest validates normally.
+    cycles_.clear();
+    buildAdjacency(edges);
+    order_ = topologicalOrder();
+    while (order_.size() < courseCount()) {
+        QVector<int> cycle = findCycle();
+        QStringList report;
+        for (int course : cycle) {
+            report.append(codes_[course]);
+        }
+        report.append(codes_[cycle.first()]);
+        qDebug() << "Skipping prerequisite" << report.last() << "of"
+                 << report.at(report.size() - 2) << ": prerequisite cycle" << report.join(" -> ");
+        cycles_.append(report);
+
+        int course = cycle.last();
+        int prereq = cycle.first();
+        edges.removeIf([=](const Edge& edge) { return edge.course == course && edge.prereq == prereq; });
+        buildAdjacency(edges);
+        order_ = topologicalOrder();
+    }
+
+    computeLevels();
+    if (sameCourses) {
+        updateClosure(oldPrereqs, oldCoreqs);
+    } else {
+        buildClosure();
+    }
+
+    qDebug() << "Loaded prerequisite graph:" << courseCount() << "courses,"
+             << prereqs_.size() << "prerequisites," << cycles_.size() << "cycles in"
+             << timer.elapsed() << "ms";
+    return true;
+}
+
+// Counting sort of the edges into the CSR arrays, by course for
+// prerequisites and by prerequisite for dependents
+void PrerequisiteGraph::buildAdjacency(const QVector<Edge>& edges) {
+    auto buildRows = [this, &edges](bool byPrereq, QVector<int>& offsets, QVector<int>& targets) {
+        offsets.fill(0, courseCount() + 1);
+        for (const auto& edge : edges) {
+            ++offsets[(byPrereq ? edge.prereq : edge.course) + 1];
+        }
+        for (int i = 0; i < courseCount(); ++i) {
+            offsets[i + 1] += offsets[i];
+        }
+        targets.resize(edges.size());
+        QVector<int> next(offsets.begin(), offsets.end() - 1);
+        for (const auto& edge : edges) {
+            if (byPrereq) {
+                targets[next[edge.prereq]++] = edge.course;
+            } else {
+                targets[next[edge.course]++] = edge.prereq;
+            }
+        }
+    };
+    buildRows(false, prereqOffsets_, prereqs_);
+    buildRows(true, dependentOffsets_, dependents_);
+
+    prereqMasks_.fill(CourseSet(courseCount()), courseCount());
+    coreqMasks_.fill(CourseSet(courseCount()), courseCount());
+    for (const auto& edge : edges) {
+        (edge.corequisite ? coreqMasks_ : prereqMasks_)[edge.course].insert(edge.prereq);
+    }
+}
+
+// Courses with every prerequisite ahead of them (Kahn's algorithm). Courses
+// on or behind a cycle never become ready and are left out.
+QVector<int> PrerequisiteGraph::topologicalOrder() const {
+    QVector<int> remaining(courseCount());
+    QVector<int> order;
+    order.reserve(courseCount());
+    for (int course = 0; course < courseCount(); ++course) {
+        remaining[course] = prerequisites(course).size();
+        if (remaining[course] == 0) {
+            order.append(course);
+        }
+    }
+    for (int i = 0; i < order.size(); ++i) {
+        for (int dependent : dependents(order[i])) {
+            if (--remaining[dependent] == 0) {
+                order.append(dependent);
+            }
+        }
+    }
+    return order;
+}
+
+// A course left out of order_ always has a prerequisite that was left out
+// too, so following those ends up going round a cycle. Returned so that
+// each course requires the next and the last requires the first.
+QVector<int> PrerequisiteGraph::findCycle() const {
+    QVector<bool> ordered(courseCount(), false);
+    for (int course : order_) {
+        ordered[course] = true;
+    }
+    int start = int(std::find(ordered.cbegin(), ordered.cend(), false) - ordered.cbegin());
+
+    QVector<int> position(courseCount(), -1);
+    QVector<int> path;
+    for (int course = start; position[course] < 0;) {
+        position[course] = int(path.size());
+        path.append(course);
+        for (int prereq : prerequisites(course)) {
+            if (!ordered[prereq]) {
+                course = prereq;
+                break;
+            }
+        }
+        if (position[course] >= 0) {
+            return path.mid(position[course]);
+        }
+    }
+    return path;
+}
+
+// In order_, every prerequisite has its numbers before the courses needing it
+void PrerequisiteGraph::computeLevels() {
+    levels_.fill(0, courseCount());
+    depths_.fill(0, courseCount());
+    for (int course : order_) {
+        for (int prereq : prerequisites(course)) {
+            levels_[course] = qMax(levels_[course], levels_[prereq] + 1);
+            int depth = depths_[prereq] + (isCorequisite(course, prereq) ? 0 : 1);
+            depths_[course] = qMax(depths_[course], depth);
+        }
+    }
+}
+
+void PrerequisiteGraph::closeAncestors(int course) {
+    for (int prereq : prerequisites(course)) {
+        ancestors_[course] |= ancestors_[prereq];
+        ancestors_[course].insert(prereq);
+    }
+}
+
+void PrerequisiteGraph::closeUnlocks(int course) {
+    for (int dependent : dependents(course)) {
+        unlocks_[course] |= unlocks_[dependent];
+        unlocks_[course].insert(dependent);
+    }
+}
+
+void PrerequisiteGraph::buildClosure() {
+    ancestors_.fill(CourseSet(courseCount()), courseCount());
+    unlocks_.fill(CourseSet(courseCount()), courseCount());
+
+    // One union per edge
+    for (int course : order_) {
+        closeAncestors(course);
+    }
+    for (auto it = order_.crbegin(); it != order_.crend(); ++it) {
+        closeUnlocks(*it);
+    }
+}
+
+// Only a course that reached a changed edge through unchanged ones can
+// have a different closure: the ancestors of the changed edges' courses and
+// their old unlocks, and the unlocks of the changed prerequisites and their
+// old ancestors. Those are recomputed from scratch, the rest kept.
+void PrerequisiteGraph::updateClosure(const QVector<CourseSet>& oldPrereqs,
+                                      const QVector<CourseSet>& oldCoreqs) {
+    CourseSet down(courseCount());
+    CourseSet up(courseCount());
+    int changedCourses = 0;
+    for (int course = 0; course < courseCount(); ++course) {
+        CourseSet oldMask = oldPrereqs.at(course);
+        oldMask |= oldCoreqs.at(course);
+        CourseSet newMask = prereqMasks_.at(course);
+        newMask |= coreqMasks_.at(course);
+        if (oldMask == newMask) {
+            continue;
+        }
+        ++changedCourses;
+        down.insert(course);
+        down |= unlocks_[course];
+        auto touch = [&](int prereq) {
+            up.insert(prereq);
+            up |= ancestors_[prereq];
+        };
+        oldMask.forEach([&](int prereq) { if (!newMask.contains(prereq)) touch(prereq); });
+        newMask.forEach([&](int prereq) { if (!oldMask.contains(prereq)) touch(prereq); });
+    }
+    if (changedCourses == 0) {
+        return;
+    }
+
+    if (down.count() + up.count() > courseCount()) {
+        buildClosure();
+        return;
+    }
+    for (int course : order_) {
+        if (down.contains(course)) {
+            ancestors_[course] = CourseSet(courseCount());
+            closeAncestors(course);
+        }
+    }
+    for (auto it = order_.crbegin(); it != order_.crend(); ++it) {
+        if (up.contains(*it)) {
+            unlocks_[*it] = CourseSet(courseCount());
+            closeUnlocks(*it);
+        }
+    }
+    qDebug() << "Prerequisites of" << changedCourses << "courses changed; recomputed"
+             << down.count() << "ancestor and" << up.count() << "unlock sets";
+}
@@ -0,0 +1,122 @@
+#ifndef PREREQUISITEGRAPH_H
+#define PREREQUISITEGRAPH_H
+
+#include "courseset.h"
+
+#include <QHash>
+#include <QList>
+#include <QSqlDatabase>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+// The active catalog's course_prereq table, read once into compressed
+// sparse row arrays. Courses get dense ids 0..courseCount()-1 in
+// course_key order, and the prerequisites of course i are
+// prereqs_[prereqOffsets_[i] .. prereqOffsets_[i + 1]), so checking a course
+// touches only its own prerequisites instead of re-running a correlated
+// subquery over course_planning for every insert.
+//
+// The transitive closure is kept in both directions as one CourseSet per
+// course, so "everything CSC4307 needs" and "everything CSC1401 eventually
+// unlocks" are lookups rather than recursive queries. Levels and chain
+// depths are computed in the same load, after any prerequisite cycle has
+// been reported and broken.
+class PrerequisiteGraph
+{
+public:
+    // The graph of the catalog attached to the default connection, loaded
+    // on first use and kept until InstitutionCatalog switches catalogs
+    static const PrerequisiteGraph& active();
+    static void invalidate();
+    // Re-reads the active graph after course_prereq changed underneath it;
+    // CatalogImporter and catalog migrations call it once they commit
+    static void refresh();
+
+    // Reloading the same course list only recomputes the closure of the
+    // courses whose prerequisite chains went through a changed edge
+    bool load(QSqlDatabase& db);
+
+    // Changes with every load, so caches built from a graph can tell a
+    // reloaded or switched catalog apart
+    int version() const { return version_; }
+
+    int courseCount() const { return int(codes_.size()); }
+    // -1 for a code the catalog doesn't know
+    int courseId(const QString& courseCode) const { return ids_.value(courseCode, -1); }
+    QString courseCode(int course) const { return codes_.at(course); }
+
+    // Prerequisites of course as ids, straight out of the CSR arrays
+    struct Courses {
+        const int* first;
+        const int* last;
+        const int* begin() const { return first; }
+        const int* end() const { return last; }
+        int size() const { return int(last - first); }
+    };
+    Courses prerequisites(int course) const {
+        const int* base = prereqs_.constData();
+        return {base + prereqOffsets_.at(course), base + prereqOffsets_.at(course + 1)};
+    }
+    // The same prerequisites as sets, for word-parallel tests against a
+    // plan: ones that must be taken in an earlier semester, and corequisites
+    // that may also be taken alongside course
+    const CourseSet& prerequisiteMask(int course) const { return prereqMasks_.at(course); }
+    const CourseSet& corequisiteMask(int course) const { return coreqMasks_.at(course); }
+    bool isCorequisite(int course, int prereq) const { return coreqMasks_.at(course).contains(prereq); }
+    // Courses listing course as a direct prerequisite
+    Courses dependents(int course) const {
+        const int* base = dependents_.constData();
+        return {base + dependentOffsets_.at(course), base + dependentOffsets_.at(course + 1)};
+    }
+
+    // Every course reachable through prerequisite chains, course excluded
+    const CourseSet& allPrerequisites(int course) const { return ancestors_.at(course); }
+    const CourseSet& unlocks(int course) const { return unlocks_.at(course); }
+
+    // Every course after all of its prerequisites
+    const QVector<int>& order() const { return order_; }
+    // Length of the longest prerequisite chain ending at course
+    int level(int course) const { return levels_.at(course); }
+    // Fewest semesters that hold course and everything it needs, with
+    // corequisites sharing a semester
+    int minimumSemesters(int course) const { return depths_.at(course) + 1; }
+    // Cycles found in course_prereq as course codes, first one repeated at
+    // the end; the prerequisite closing each was left out of the graph
+    const QList<QStringList>& cycles() const { return cycles_; }
+
+private:
+    int version_ = 0;
+    QVector<QString> codes_;
+    QHash<QString, int> ids_;
+    QVector<int> prereqOffsets_;
+    QVector<int> prereqs_;
+    QVector<CourseSet> prereqMasks_;
+    QVector<CourseSet> coreqMasks_;
+    QVector<int> dependentOffsets_;
+    QVector<int> dependents_;
+    QVector<CourseSet> ancestors_;
+    QVector<CourseSet> unlocks_;
+    QVector<int> order_;    // topological, prerequisites first
+    QVector<int> levels_;
+    QVector<int> depths_;
+    QList<QStringList> cycles_;
+
+    struct Edge {
+        int course;
+        int prereq;
+        bool corequisite;
+    };
+
+    void clear();
+    void buildAdjacency(const QVector<Edge>& edges);
+    QVector<int> topologicalOrder() const;
+    QVector<int> findCycle() const;
+    void computeLevels();
+    void buildClosure();
+    void updateClosure(const QVector<CourseSet>& oldPrereqs, const QVector<CourseSet>& oldCoreqs);
+    void closeAncestors(int course);
+    void closeUnlocks(int course);
+};
+
+#endif // PREREQUISITEGRAPH_H
@@ -0,0 +1,58 @@
+#include "semester.h"
+
+Semester Semester::fromOrdinal(int ordinal) {
+    Semester semester;
+    semester.ordinal_ = ordinal < 0 ? -1 : ordinal;
+    return semester;
+}
+
+Semester Semester::fromCode(const QString& code) {
+    QString text = code.trimmed();
+
+    int digits = 0;
+    while (digits < text.size() && !text.at(digits).isDigit()) {
+        ++digits;
+    }
+
+    Term term;
+    bool ok = false;
+    int year = text.mid(digits).toInt(&ok);
+    if (!ok || !parseTerm(text.left(digits).trimmed(), term)) {
+        return Semester();
+    }
+
+    return Semester(year, term);
+}
+
+bool Semester::parseTerm(const QString& name, Term& term) {
+    if (name.compare("FALL", Qt::CaseInsensitive) == 0) {
+        term = Fall;
+    } else if (name.compare("SPRING", Qt::CaseInsensitive) == 0) {
+        term = Spring;
+    } else if (name.compare("SUMMER", Qt::CaseInsensitive) == 0) {
+        term = Summer;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+QString Semester::termName(Term term) {
+    switch (term) {
+    case Spring:
+        return "SPRING";
+    case Summer:
+        return "SUMMER";
+    case Fall:
+        return "FALL";
+    }
+    return QString();
+}
+
+QString Semester::code() const {
+    return isValid() ? termName() + QString::number(year()) : QString();
+}
+
+QString Semester::title() const {
+    return isValid() ? termName() + " " + QString::number(year()) : QString();
+}
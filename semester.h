@@ -0,0 +1,40 @@
+#ifndef SEMESTER_H
+#define SEMESTER_H
+
+#include <QString>
+
+// A term packed into one integer, year * 3 + term, so semesters compare,
+// sort and join as plain ints. Codes like "FALL2024" only exist for display
+// and for the sem_code column.
+class Semester
+{
+public:
+    enum Term { Spring = 0, Summer = 1, Fall = 2 };
+
+    Semester() = default;
+    Semester(int year, Term term) : ordinal_(year * 3 + term) {}
+
+    static Semester fromOrdinal(int ordinal);
+    // Accepts "FALL2024", "FALL 2024" and "Fall 2024"
+    static Semester fromCode(const QString& code);
+    static bool parseTerm(const QString& name, Term& term);
+    static QString termName(Term term);
+
+    bool isValid() const { return ordinal_ >= 0; }
+    int ordinal() const { return ordinal_; }
+    int year() const { return ordinal_ / 3; }
+    Term term() const { return static_cast<Term>(ordinal_ % 3); }
+
+    QString termName() const { return termName(term()); }
+    QString code() const;   // "FALL2024"
+    QString title() const;  // "FALL 2024"
+
+    bool operator==(const Semester& other) const { return ordinal_ == other.ordinal_; }
+    bool operator!=(const Semester& other) const { return ordinal_ != other.ordinal_; }
+    bool operator<(const Semester& other) const { return ordinal_ < other.ordinal_; }
+
+private:
+    int ordinal_ = -1;
+};
+
+#endif // SEMESTER_H
@@ -0,0 +1,21 @@
+QT += core sql testlib
+QT -= gui
+
+CONFIG += c++17 console testcase
+CONFIG -= app_bundle
+
+TARGET = tst_institutioncatalog
+
+APP = $$PWD/../..
+INCLUDEPATH += $$APP
+
+SOURCES += \
+    tst_institutioncatalog.cpp \
+    $$APP/catalogimporter.cpp \
+    $$APP/connectionprofile.cpp \
+    $$APP/databaseinitializer.cpp \
+    $$APP/institutioncatalog.cpp \
+    $$APP/prerequisitegraph.cpp \
+    $$APP/semester.cpp
+
+include($$APP/catalog/catalogdata.pri)
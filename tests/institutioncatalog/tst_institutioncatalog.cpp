@@ -0,0 +1,94 @@
+#include "catalogimporter.h"
+#include "databaseinitializer.h"
+#include "institutioncatalog.h"
+#include "prerequisitegraph.h"
+
+#include <QDir>
+#include <QFile>
+#include <QSqlDatabase>
+#include <QSqlQuery>
+#include <QTemporaryDir>
+#include <QtTest>
+
+// A freshly initialized database next to a second institution's catalog,
+// imported the way --institution does it: the welcome window must offer it
+// and activating it must switch the unqualified catalog tables over.
+class TestInstitutionCatalog : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void cleanupTestCase();
+    void listsImportedCatalog();
+    void switchesToImportedCatalog();
+
+private:
+    QTemporaryDir dir_;
+
+    bool importSecondCatalog();
+};
+
+bool TestInstitutionCatalog::importSecondCatalog() {
+    QFile courses(dir_.filePath("courses.csv"));
+    if (!courses.open(QIODevice::WriteOnly | QIODevice::Text)) {
+        return false;
+    }
+    courses.write("course_code,course_title,course_description,course_credits,"
+                  "course_classification,dep_code,course_type,course_level\n"
+                  "UM6P101,Imported course,,3,,CS,Core,1000\n");
+    courses.close();
+
+    bool ok = false;
+    {
+        QSqlDatabase db = QSqlDatabase::addDatabase("QSQLITE", "catalog_import");
+        db.setDatabaseName(dir_.filePath("catalogs/UM6P.db"));
+        ok = db.open()
+            && DatabaseInitializer::initializeCatalog(db)
+            && InstitutionCatalog::setName(db, "UM6P", "Mohammed VI Polytechnic University")
+            && CatalogImporter::importCourses(db, courses.fileName());
+        db.close();
+    }
+    QSqlDatabase::removeDatabase("catalog_import");
+    return ok;
+}
+
+void TestInstitutionCatalog::initTestCase() {
+    QVERIFY(dir_.isValid());
+    QVERIFY(DatabaseInitializer::initializeDatabase(dir_.filePath("DegreePlanner.db")));
+    QVERIFY(QDir(dir_.path()).mkpath("catalogs"));
+    QVERIFY(importSecondCatalog());
+}
+
+void TestInstitutionCatalog::cleanupTestCase() {
+    PrerequisiteGraph::invalidate();
+    QSqlDatabase::database().close();
+}
+
+void TestInstitutionCatalog::listsImportedCatalog() {
+    QList<Institution> institutions = InstitutionCatalog::available(QSqlDatabase::database());
+    QCOMPARE(institutions.size(), 2);
+    QCOMPARE(institutions.at(0).code, InstitutionCatalog::defaultCode);
+    QCOMPARE(institutions.at(1).code, QString("UM6P"));
+    QCOMPARE(institutions.at(1).name, QString("Mohammed VI Polytechnic University"));
+}
+
+void TestInstitutionCatalog::switchesToImportedCatalog() {
+    QSqlDatabase db = QSqlDatabase::database();
+    QVERIFY(InstitutionCatalog::activate(db, "UM6P"));
+
+    QSqlQuery query(db);
+    QVERIFY(query.exec("SELECT course_code FROM course"));
+    QVERIFY(query.next());
+    QCOMPARE(query.value(0).toString(), QString("UM6P101"));
+    QVERIFY(!query.next());
+    query.finish();
+
+    QVERIFY(InstitutionCatalog::activate(db, InstitutionCatalog::defaultCode));
+    QVERIFY(query.exec("SELECT count(*) FROM course"));
+    QVERIFY(query.next());
+    QVERIFY(query.value(0).toInt() > 1);
+}
+
+QTEST_GUILESS_MAIN(TestInstitutionCatalog)
+#include "tst_institutioncatalog.moc"
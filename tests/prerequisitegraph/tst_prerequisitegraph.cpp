@@ -0,0 +1,125 @@
+#include "catalogimporter.h"
+#include "databaseinitializer.h"
+#include "prerequisitegraph.h"
+
+#include <QFile>
+#include <QSqlDatabase>
+#include <QSqlQuery>
+#include <QTemporaryDir>
+#include <QtTest>
+
+// The active graph patched in place after a catalog change must close over
+// prerequisites exactly like a graph loaded from scratch.
+class TestPrerequisiteGraph : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void cleanupTestCase();
+    void importedEdge();
+    void removedEdge();
+    void corequisiteFlag();
+
+private:
+    QTemporaryDir dir_;
+
+    bool writeFile(const QString& name, const QStringList& lines);
+    void compareWithFreshLoad();
+};
+
+bool TestPrerequisiteGraph::writeFile(const QString& name, const QStringList& lines) {
+    QFile file(dir_.filePath(name));
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
+        return false;
+    }
+    file.write(lines.join('\n').toUtf8() + '\n');
+    return true;
+}
+
+void TestPrerequisiteGraph::compareWithFreshLoad() {
+    QSqlDatabase db = QSqlDatabase::database();
+    const PrerequisiteGraph& active = PrerequisiteGraph::active();
+    PrerequisiteGraph fresh;
+    QVERIFY(fresh.load(db));
+    QCOMPARE(active.courseCount(), fresh.courseCount());
+    for (int course = 0; course < fresh.courseCount(); ++course) {
+        QByteArray code = fresh.courseCode(course).toUtf8();
+        QVERIFY2(active.allPrerequisites(course) == fresh.allPrerequisites(course), code.constData());
+        QVERIFY2(active.unlocks(course) == fresh.unlocks(course), code.constData());
+    }
+}
+
+// Two chains of six and four unrelated courses, so a change to one edge
+// stays small enough to be patched rather than rebuilt
+void TestPrerequisiteGraph::initTestCase() {
+    QVERIFY(dir_.isValid());
+    QSqlDatabase db = QSqlDatabase::addDatabase("QSQLITE");
+    db.setDatabaseName(dir_.filePath("catalog.db"));
+    QVERIFY(db.open());
+    QVERIFY(DatabaseInitializer::initializeCatalog(db));
+
+    QStringList courses = {"course_code,course_title,course_description,course_credits,"
+                        "course_classification,dep_code,course_type,course_level"};
+    QStringList prereqs = {"course_code,prereq,prereq_is_corequisite"};
+    for (QString chain : {"A", "B"}) {
+        for (int i = 1; i <= 6; ++i) {
+            courses << QString("%1%2,Course %1%2,,3,,CSC,Core,1000").arg(chain).arg(i);
+            if (i > 1) {
+                prereqs << QString("%1%2,%1%3,0").arg(chain).arg(i).arg(i - 1);
+            }
+        }
+    }
+    for (int i = 1; i <= 4; ++i) {
+        courses << QString("C%1,Course C%1,,3,,CSC,Elective,1000").arg(i);
+    }
+    QVERIFY(writeFile("courses.csv", courses));
+    QVERIFY(writeFile("prereqs.csv", prereqs));
+    QVERIFY(CatalogImporter::importCourses(db, dir_.filePath("courses.csv")));
+    QVERIFY(CatalogImporter::importPrerequisites(db, dir_.filePath("prereqs.csv")));
+
+    // Loaded before the changes below, which refresh it in place
+    QCOMPARE(PrerequisiteGraph::active().courseCount(), 16);
+}
+
+void TestPrerequisiteGraph::cleanupTestCase() {
+    PrerequisiteGraph::invalidate();
+    QSqlDatabase::database().close();
+}
+
+void TestPrerequisiteGraph::importedEdge() {
+    const PrerequisiteGraph& graph = PrerequisiteGraph::active();
+    int version = graph.version();
+    QVERIFY(writeFile("more.csv", QStringList() << "course_code,prereq,prereq_is_corequisite"
+                                                << "B3,A2,0"));
+    QSqlDatabase db = QSqlDatabase::database();
+    QVERIFY(CatalogImporter::importPrerequisites(db, dir_.filePath("more.csv")));
+
+    QVERIFY(graph.version() != version);
+    QVERIFY(graph.unlocks(graph.courseId("A1")).contains(graph.courseId("B6")));
+    compareWithFreshLoad();
+}
+
+void TestPrerequisiteGraph::removedEdge() {
+    QSqlQuery query;
+    QVERIFY(query.exec("DELETE FROM course_prereq WHERE course_code = 'A4' AND prereq = 'A3'"));
+    PrerequisiteGraph::refresh();
+
+    const PrerequisiteGraph& graph = PrerequisiteGraph::active();
+    QVERIFY(!graph.allPrerequisites(graph.courseId("A6")).contains(graph.courseId("A1")));
+    compareWithFreshLoad();
+}
+
+void TestPrerequisiteGraph::corequisiteFlag() {
+    QSqlQuery query;
+    QVERIFY(query.exec("UPDATE course_prereq SET prereq_is_corequisite = 1 "
+                       "WHERE course_code = 'B5' AND prereq = 'B4'"));
+    PrerequisiteGraph::refresh();
+
+    const PrerequisiteGraph& graph = PrerequisiteGraph::active();
+    QVERIFY(graph.isCorequisite(graph.courseId("B5"), graph.courseId("B4")));
+    compareWithFreshLoad();
+}
+
+QTEST_GUILESS_MAIN(TestPrerequisiteGraph)
+#include "tst_prerequisitegraph.moc"
@@ -0,0 +1,20 @@
+QT += core sql testlib
+QT -= gui
+
+CONFIG += c++17 console testcase
+CONFIG -= app_bundle
+
+TARGET = tst_queryplans
+
+APP = $$PWD/../..
+INCLUDEPATH += $$APP
+
+SOURCES += \
+    tst_queryplans.cpp \
+    $$APP/connectionprofile.cpp \
+    $$APP/databaseinitializer.cpp \
+    $$APP/institutioncatalog.cpp \
+    $$APP/prerequisitegraph.cpp \
+    $$APP/semester.cpp
+
+include($$APP/catalog/catalogdata.pri)
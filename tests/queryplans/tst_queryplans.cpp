@@ -0,0 +1,39 @@
+#include "databaseinitializer.h"
+#include "prerequisitegraph.h"
+
+#include <QSqlDatabase>
+#include <QTemporaryDir>
+#include <QtTest>
+
+// Every query in PlanQueries against a freshly seeded database: the hot
+// ones must use an index and the whole-table reads must still prepare.
+class TestQueryPlans : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void cleanupTestCase();
+    void everyQueryHasAPlan();
+
+private:
+    QTemporaryDir dir_;
+};
+
+void TestQueryPlans::initTestCase() {
+    QVERIFY(dir_.isValid());
+    QVERIFY(DatabaseInitializer::initializeDatabase(dir_.filePath("degreePlan.db")));
+}
+
+void TestQueryPlans::cleanupTestCase() {
+    PrerequisiteGraph::invalidate();
+    QSqlDatabase::database().close();
+}
+
+void TestQueryPlans::everyQueryHasAPlan() {
+    QSqlDatabase db = QSqlDatabase::database();
+    QVERIFY(DatabaseInitializer::checkQueryPlans(db));
+}
+
+QTEST_GUILESS_MAIN(TestQueryPlans)
+#include "tst_queryplans.moc"
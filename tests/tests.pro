@@ -0,0 +1,7 @@
+# qmake tests/tests.pro && make check
+TEMPLATE = subdirs
+
+SUBDIRS += \
+    institutioncatalog \
+    prerequisitegraph \
+    queryplans
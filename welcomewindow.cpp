@@ -1,11 +1,15 @@
 #include "welcomewindow.h"
 #include "global_objects.h"
+#include "institutioncatalog.h"
+#include "planqueries.h"
 #include "qsqlerror.h"
 #include "qsqlquery.h"
 #include "ui_welcomewindow.h"
 
 #include <QGraphicsDropShadowEffect>
 #include <QDate>
+#include <QMessageBox>
+#include <QSignalBlocker>
 
 WelcomeWindow::WelcomeWindow(QWidget *parent)
     : QMainWindow(parent)
@@ -14,6 +18,7 @@ WelcomeWindow::WelcomeWindow(QWidget *parent)
     ui->setupUi(this);
 
     populateGraduationYears();
+    populateInstitutions();
     populateMajor();
 
     ui->stackedWidget->setCurrentIndex(0);
@@ -60,7 +65,7 @@ void WelcomeWindow::populateGraduationYears()
 void WelcomeWindow::populateMajor(){
 
     QSqlQuery query;
-    query.exec("Select major_name from major");
+    query.exec(PlanQueries::majorNames);
 
     while(query.next()){
         QString name = query.value(0).toString();
@@ -68,6 +73,45 @@ void WelcomeWindow::populateMajor(){
     }
 }
 
+void WelcomeWindow::populateInstitutions(){
+    QSqlDatabase db = QSqlDatabase::database();
+    const QList<Institution> institutions = InstitutionCatalog::available(db);
+
+    // Majors are filled in by the constructor for the first entry
+    QSignalBlocker blocker(ui->institution_combobox);
+    for (const Institution& institution : institutions) {
+        ui->institution_combobox->addItem(institution.name, institution.code);
+    }
+    ui->institution_combobox->setCurrentIndex(0);
+    activeInstitution = 0;
+
+    // Nothing to choose with only the bundled catalog installed
+    bool choice = institutions.size() > 1;
+    ui->institution_label->setVisible(choice);
+    ui->institution_combobox->setVisible(choice);
+}
+
+void WelcomeWindow::on_institution_combobox_currentIndexChanged(int index)
+{
+    QSqlDatabase db = QSqlDatabase::database();
+    QString code = ui->institution_combobox->itemData(index).toString();
+    if (!InstitutionCatalog::activate(db, code)) {
+        // Majors and the saved profile must match the catalog still attached
+        {
+            QSignalBlocker blocker(ui->institution_combobox);
+            ui->institution_combobox->setCurrentIndex(activeInstitution);
+        }
+        QMessageBox::warning(this, "Institution",
+                             "The catalog for " + ui->institution_combobox->itemText(index)
+                                 + " couldn't be opened.");
+        return;
+    }
+    activeInstitution = index;
+
+    ui->comboBox_2->clear();
+    populateMajor();
+}
+
 void WelcomeWindow::on_continueButton_1_clicked()
 {
     int currentPage;
@@ -104,15 +148,21 @@ void WelcomeWindow::on_confirm_button_clicked()
 
     //qDebug() << fname + " " + lname + " " + std::to_string(total_credits) + " " + std::to_string(graduation_year) + " " + std::to_string(starting_year) + " " + starting_semester + " " + major;
 
+    QString institution = ui->institution_combobox->currentData().toString();
+    if (institution.isEmpty()) {
+        institution = InstitutionCatalog::defaultCode;
+    }
+
     QSqlQuery query;
-    query.prepare("INSERT INTO profile (fname, lname, graduation_year, starting_year, starting_semester, major, minor)"
-                  "VALUES (:fname, :lname, :graduation_year, :starting_year, :starting_semester, :major, :minor)");
+    query.prepare("INSERT INTO profile (fname, lname, graduation_year, starting_year, starting_semester, major, minor, institution)"
+                  "VALUES (:fname, :lname, :graduation_year, :starting_year, :starting_semester, :major, :minor, :institution)");
     query.bindValue(":fname", QString::fromStdString(fname));
     query.bindValue(":lname", QString::fromStdString(lname));
     query.bindValue(":graduation_year", graduation_year);
     query.bindValue(":starting_year", starting_year);
     query.bindValue(":starting_semester", QString::fromStdString(starting_semester));
     query.bindValue(":major", QString::fromStdString(major));
+    query.bindValue(":institution", institution);
     if (!minor.empty()){
         query.bindValue(":major", QString::fromStdString(minor));
     }
@@ -130,6 +180,7 @@ void WelcomeWindow::on_confirm_button_clicked()
         qDebug() << "Insert failed:" << query.lastError().text();
     }
     profile_id = profileId;
+    ++plan_revision;
     w.refreshWindow();
     w.show();
     close();
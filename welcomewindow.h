@@ -39,8 +39,11 @@ private slots:
     void on_total_credits_line_textChanged(const QString &arg1);
 
     void populateMajor();
+    void populateInstitutions();
     void on_comboBox_2_currentIndexChanged(int index);
 
+    void on_institution_combobox_currentIndexChanged(int index);
+
     void on_continueButton_3_clicked();
 
     void on_continueButton_4_clicked();
@@ -48,6 +51,8 @@ private slots:
 private:
     Ui::WelcomeWindow *ui;
     MainWindow w;
+    // Combo box entry whose catalog is attached
+    int activeInstitution = 0;
 };
 
 #endif // WELCOMEWINDOW_H